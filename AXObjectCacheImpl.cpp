@@ -79,6 +79,7 @@
 #include "modules/accessibility/AXTableColumn.h"
 #include "modules/accessibility/AXTableHeaderContainer.h"
 #include "modules/accessibility/AXTableRow.h"
+#include "wtf/HashSet.h"
 #include "wtf/PassRefPtr.h"
 #include "wtf/PtrUtil.h"
 
@@ -621,6 +622,11 @@ void AXObjectCacheImpl::childrenChanged(AXObject* obj) {
 void AXObjectCacheImpl::notificationPostTimerFired(TimerBase*) {
   m_notificationPostTimer.stop();
 
+  // Bulk DOM mutations queue the same notification for the same object many
+  // times before the timer fires. Only the first one of each is delivered;
+  // later duplicates would make the platform layer refetch the same subtree.
+  HashSet<uint64_t> postedNotifications;
+
   unsigned i = 0, count = m_notificationsToPost.size();
   for (i = 0; i < count; ++i) {
     AXObject* obj = m_notificationsToPost[i].first;
@@ -631,6 +637,12 @@ void AXObjectCacheImpl::notificationPostTimerFired(TimerBase*) {
     if (obj->isDetached())
       continue;
 
+    AXNotification notification = m_notificationsToPost[i].second;
+    uint64_t key = (static_cast<uint64_t>(obj->axObjectID()) << 32) |
+                   static_cast<uint32_t>(notification);
+    if (!postedNotifications.insert(key).isNewEntry)
+      continue;
+
 #if DCHECK_IS_ON()
     // Make sure none of the layout views are in the process of being layed out.
     // Notifications should only be sent after the layoutObject has finished
@@ -642,7 +654,6 @@ void AXObjectCacheImpl::notificationPostTimerFired(TimerBase*) {
     }
 #endif
 
-    AXNotification notification = m_notificationsToPost[i].second;
     postPlatformNotification(obj, notification);
 
     if (notification == AXChildrenChanged && obj->parentObjectIfExists() &&
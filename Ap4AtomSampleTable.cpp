@@ -120,17 +120,24 @@ AP4_AtomSampleTable::GetSample(AP4_Ordinal index,
     if (AP4_FAILED(result)) return result;
     
     // compute the additional offset inside the chunk
-    for (unsigned int i = index-skip; i < index; i++) {
-        AP4_Size size = 0;
-        if (m_StszAtom) {
-            result = m_StszAtom->GetSampleSize(i, size); 
-        } else if (m_Stz2Atom) {
-            result = m_Stz2Atom->GetSampleSize(i, size); 
-        } else {
-            result = AP4_ERROR_INVALID_FORMAT;
+    // (the size table doesn't change inside the loop, so pick it once: with
+    // large chunks this loop is the dominant cost of GetSample)
+    if (m_StszAtom) {
+        for (unsigned int i = index-skip; i < index; i++) {
+            AP4_Size size = 0;
+            result = m_StszAtom->GetSampleSize(i, size);
+            if (AP4_FAILED(result)) return result;
+            offset += size;
         }
-        if (AP4_FAILED(result)) return result;
-        offset += size;
+    } else if (m_Stz2Atom) {
+        for (unsigned int i = index-skip; i < index; i++) {
+            AP4_Size size = 0;
+            result = m_Stz2Atom->GetSampleSize(i, size);
+            if (AP4_FAILED(result)) return result;
+            offset += size;
+        }
+    } else if (skip) {
+        return AP4_ERROR_INVALID_FORMAT;
     }
 
     // set the description index
@@ -148,6 +148,12 @@ AP4_Processor::ProcessFragments(AP4_MoovAtom*              moov,
 {
     unsigned int fragment_index = 0;
     AP4_Array<FragmentMapEntry> fragment_map;
+
+    // the sample buffers are shared by all fragments so that they only need
+    // to grow to the largest sample once, instead of once per fragment
+    AP4_Sample         sample;
+    AP4_DataBuffer     sample_data_in;
+    AP4_DataBuffer     sample_data_out;
     
     for (AP4_List<AP4_AtomLocator>::Item* item = atoms.FirstItem();
                                           item;
@@ -156,9 +162,6 @@ AP4_Processor::ProcessFragments(AP4_MoovAtom*              moov,
         AP4_Atom*          atom        = locator->m_Atom;
         AP4_UI64           atom_offset = locator->m_Offset;
         AP4_UI64           mdat_payload_offset = atom_offset+atom->GetSize()+AP4_ATOM_HEADER_SIZE;
-        AP4_Sample         sample;
-        AP4_DataBuffer     sample_data_in;
-        AP4_DataBuffer     sample_data_out;
         AP4_Result         result;
     
         // if this is not a moof atom, just write it back and continue
@@ -285,7 +288,8 @@ AP4_Processor::ProcessFragments(AP4_MoovAtom*              moov,
             trun->SetDataOffset((AP4_SI32)((mdat_out_start+mdat_size)-base_data_offset));
             
             // write the mdat
-            for (unsigned int j=0; j<sample_tables[i]->GetSampleCount(); j++, trun_sample_index++) {
+            AP4_Cardinal sample_count = sample_tables[i]->GetSampleCount();
+            for (unsigned int j=0; j<sample_count; j++, trun_sample_index++) {
                 // advance the trun index if necessary
                 if (trun_sample_index >= trun->GetEntries().ItemCount()) {
                     trun = truns[++trun_index];
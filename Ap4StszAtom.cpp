@@ -80,18 +80,21 @@ AP4_StszAtom::AP4_StszAtom(AP4_UI32        size,
         }
         
         // read the entries
+        // (read straight into the entries array and convert in place, so
+        // that large tables don't need a second buffer of the same size)
         AP4_Cardinal sample_count = m_SampleCount;
+        if (sample_count == 0) return;
         m_Entries.SetItemCount(sample_count);
-        unsigned char* buffer = new unsigned char[sample_count*4];
+        unsigned char* buffer = reinterpret_cast<unsigned char*>(&m_Entries[0]);
         AP4_Result result = stream.Read(buffer, sample_count*4);
         if (AP4_FAILED(result)) {
-            delete[] buffer;
+            // don't leave partially read bytes behind
+            for (unsigned int i=0; i<sample_count; i++) m_Entries[i] = 0;
             return;
         }
         for (unsigned int i=0; i<sample_count; i++) {
             m_Entries[i] = AP4_BytesToUInt32BE(&buffer[i*4]);
         }
-        delete[] buffer;
     }
 }
 
@@ -15,6 +15,7 @@
  */
 
 #include <unistd.h>
+#include <limits.h>
 
 #include "include/Context.h"
 #include "common/errno.h"
@@ -46,6 +47,11 @@ ostream& AsyncConnection::_conn_prefix(std::ostream *_dout) {
 
 const int AsyncConnection::TCP_PREFETCH_MIN_SIZE = 512;
 const int ASYNC_COALESCE_THRESHOLD = 256;
+// While more messages are queued, write_message only appends to
+// "outcoming_bl" until it holds this many segments or bytes, so that a burst
+// of small messages goes out in a single sendmsg instead of one per message.
+const unsigned ASYNC_SEND_BATCH_MAX_SEGMENTS = IOV_MAX;
+const unsigned ASYNC_SEND_BATCH_MAX_BYTES = 64 << 10;
 
 class C_time_wakeup : public EventCallback {
   AsyncConnectionRef conn;
@@ -118,6 +124,20 @@ static void alloc_aligned_buffer(bufferlist& data, unsigned len, unsigned off)
   }
 }
 
+// front and middle segments of at least a page get page-aligned storage so
+// read_until can fill them straight from the socket (see below)
+static bufferptr create_segment_buffer(unsigned len)
+{
+  if (len >= CEPH_PAGE_SIZE)
+    return buffer::create_page_aligned(len);
+  return buffer::create(len);
+}
+
+static inline bool is_page_aligned(const char *p)
+{
+  return (reinterpret_cast<uintptr_t>(p) & ~CEPH_PAGE_MASK) == 0;
+}
+
 AsyncConnection::AsyncConnection(CephContext *cct, AsyncMessenger *m, DispatchQueue *q,
                                  Worker *w)
   : Connection(cct, m), delay_state(NULL), async_msgr(m), conn_id(q->get_id()),
@@ -235,6 +255,11 @@ ssize_t AsyncConnection::_try_send(bool more)
 // And it will uses readahead method to reduce small read overhead,
 // "recv_buf" is used to store read buffer
 //
+// Large reads and reads into page-aligned message segments (front, middle
+// and data buffers allocated by read_message) bypass "recv_buf" once it is
+// drained, so payload bytes land directly in the message's bufferlist
+// instead of being memcpy'd out of the prefetch buffer.
+//
 // return the remaining bytes, 0 means this buffer is finished
 // else return < 0 means error
 ssize_t AsyncConnection::read_until(unsigned len, char *p)
@@ -267,8 +292,9 @@ ssize_t AsyncConnection::read_until(unsigned len, char *p)
 
   recv_end = recv_start = 0;
   /* nothing left in the prefetch buffer */
-  if (len > recv_max_prefetch) {
-    /* this was a large read, we don't prefetch for these */
+  if (len > recv_max_prefetch ||
+      (left >= (uint64_t)TCP_PREFETCH_MIN_SIZE && is_page_aligned(p + state_offset))) {
+    /* this was a large read or a zero-copy segment, we don't prefetch for these */
     do {
       r = read_bulk(p+state_offset, left);
       ldout(async_msgr->cct, 25) << __func__ << " read_bulk left is " << left << " got " << r << dendl;
@@ -565,7 +591,7 @@ void AsyncConnection::process()
           unsigned front_len = current_header.front_len;
           if (front_len) {
             if (!front.length())
-              front.push_back(buffer::create(front_len));
+              front.push_back(create_segment_buffer(front_len));
 
             r = read_until(front_len, front.c_str());
             if (r < 0) {
@@ -586,7 +612,7 @@ void AsyncConnection::process()
           unsigned middle_len = current_header.middle_len;
           if (middle_len) {
             if (!middle.length())
-              middle.push_back(buffer::create(middle_len));
+              middle.push_back(create_segment_buffer(middle_len));
 
             r = read_until(middle_len, middle.c_str());
             if (r < 0) {
@@ -2304,8 +2330,17 @@ ssize_t AsyncConnection::write_message(Message *m, bufferlist& bl, bool more)
   ldout(async_msgr->cct, 20) << __func__ << " sending " << m->get_seq()
                              << " " << m << dendl;
   ssize_t total_send_size = outcoming_bl.length();
-  ssize_t rc = _try_send(more);
-  if (rc < 0) {
+  ssize_t rc;
+  if (more && !open_write &&
+      outcoming_bl.buffers().size() < ASYNC_SEND_BATCH_MAX_SEGMENTS &&
+      outcoming_bl.length() < ASYNC_SEND_BATCH_MAX_BYTES) {
+    // defer the syscall, handle_write flushes the batch once the queue
+    // drains or a later message fills it
+    rc = 0;
+    logger->inc(l_msgr_send_bytes, total_send_size - original_bl_len);
+    ldout(async_msgr->cct, 10) << __func__ << " batching " << m << ", "
+                               << outcoming_bl.length() << " bytes pending" << dendl;
+  } else if ((rc = _try_send(more)) < 0) {
     ldout(async_msgr->cct, 1) << __func__ << " error sending " << m << ", "
                               << cpp_strerror(rc) << dendl;
   } else if (rc == 0) {
@@ -2499,6 +2534,8 @@ void AsyncConnection::handle_write()
       r = write_message(m, data, more);
       if (r < 0) {
         ldout(async_msgr->cct, 1) << __func__ << " send msg failed" << dendl;
+        // still account the time this worker spent before the socket failed
+        logger->tinc(l_msgr_running_send_time, ceph::mono_clock::now() - start);
         goto fail;
       }
       write_lock.lock();
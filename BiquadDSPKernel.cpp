@@ -29,6 +29,7 @@
 #include "modules/webaudio/BiquadDSPKernel.h"
 
 #include "platform/FloatConversion.h"
+#include "platform/audio/VectorMath.h"
 #include <limits.h>
 #include "wtf/Vector.h"
 
@@ -145,9 +146,10 @@ void BiquadDSPKernel::getFrequencyResponse(int nFrequencies,
     double nyquist = this->nyquist();
 
     // Convert from frequency in Hz to normalized frequency (0 -> 1),
-    // with 1 equal to the Nyquist frequency.
-    for (int k = 0; k < nFrequencies; ++k)
-        frequency[k] = narrowPrecisionToFloat(frequencyHz[k] / nyquist);
+    // with 1 equal to the Nyquist frequency. This is a single vectorized scale
+    // rather than a division per frequency.
+    float inverseNyquist = narrowPrecisionToFloat(1 / nyquist);
+    VectorMath::vsmul(frequencyHz, 1, &inverseNyquist, frequency.data(), 1, nFrequencies);
 
     double cutoffFrequency;
     double Q;
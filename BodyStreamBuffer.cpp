@@ -25,6 +25,10 @@ namespace blink {
 
 namespace {
 
+// Chunks smaller than this are merged before they are enqueued, since every
+// enqueued chunk costs a typed array, a JS wrapper and a read promise.
+const size_t coalescedChunkSize = 32 * 1024;
+
 bool isTerminating(ScriptState* scriptState)
 {
     ExecutionContext* executionContext = scriptState->getExecutionContext();
@@ -347,32 +351,55 @@ void BodyStreamBuffer::error()
 void BodyStreamBuffer::processData()
 {
     ASSERT(m_reader);
+    // Network data often arrives in many small pieces. Those are gathered
+    // here and enqueued as one chunk, either once enough has accumulated or
+    // when the handle has nothing more to give right now.
+    Vector<unsigned char> pending;
+    auto enqueuePending = [this, &pending]() {
+        if (pending.isEmpty())
+            return;
+        controller()->enqueue(DOMUint8Array::create(pending.data(), pending.size()));
+        m_streamNeedsMore = controller()->desiredSize() > 0;
+        pending.clear();
+    };
+
     while (m_streamNeedsMore) {
         const void* buffer;
         size_t available;
         WebDataConsumerHandle::Result result = m_reader->beginRead(&buffer, WebDataConsumerHandle::FlagNone, &available);
         switch (result) {
         case WebDataConsumerHandle::Ok: {
-            DOMUint8Array* array = DOMUint8Array::create(static_cast<const unsigned char*>(buffer), available);
-            controller()->enqueue(array);
-            m_streamNeedsMore = controller()->desiredSize() > 0;
+            const unsigned char* data = static_cast<const unsigned char*>(buffer);
+            if (pending.isEmpty() && available >= coalescedChunkSize) {
+                // Large chunks are enqueued directly to avoid a second copy.
+                controller()->enqueue(DOMUint8Array::create(data, available));
+                m_streamNeedsMore = controller()->desiredSize() > 0;
+            } else {
+                pending.append(data, available);
+                if (pending.size() >= coalescedChunkSize)
+                    enqueuePending();
+            }
             m_reader->endRead(available);
             break;
         }
         case WebDataConsumerHandle::Done:
+            enqueuePending();
             close();
             return;
 
         case WebDataConsumerHandle::ShouldWait:
+            enqueuePending();
             return;
 
         case WebDataConsumerHandle::Busy:
         case WebDataConsumerHandle::ResourceExhausted:
         case WebDataConsumerHandle::UnexpectedError:
+            enqueuePending();
             error();
             return;
         }
     }
+    ASSERT(pending.isEmpty());
 }
 
 void BodyStreamBuffer::endLoading()
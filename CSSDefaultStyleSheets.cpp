@@ -39,6 +39,7 @@
 #include "core/html/HTMLHtmlElement.h"
 #include "core/html/HTMLVideoElement.h"
 #include "core/rendering/RenderTheme.h"
+#include "wtf/text/StringBuilder.h"
 
 namespace WebCore {
 
@@ -80,6 +81,20 @@ static StyleSheetContents* parseUASheet(const char* characters, unsigned size)
     return parseUASheet(String(characters, size));
 }
 
+// Builds the source of a UA sheet followed by the theme's additions in a
+// single allocation, instead of copying the built-in sheet once into a String
+// and again when the theme's rules are appended.
+static StyleSheetContents* parseUASheet(const char* characters, unsigned size, const String& extraRules)
+{
+    if (extraRules.isEmpty())
+        return parseUASheet(characters, size);
+    StringBuilder rules;
+    rules.reserveCapacity(size + extraRules.length());
+    rules.append(characters, size);
+    rules.append(extraRules);
+    return parseUASheet(rules.toString());
+}
+
 void CSSDefaultStyleSheets::loadDefaultStylesheetIfNecessary()
 {
     if (!defaultStyle)
@@ -94,15 +109,13 @@ void CSSDefaultStyleSheets::loadDefaultStyle()
     defaultQuirksStyle = RuleSet::create().leakPtr();
 
     // Strict-mode rules.
-    String defaultRules = String(htmlUserAgentStyleSheet, sizeof(htmlUserAgentStyleSheet)) + RenderTheme::theme().extraDefaultStyleSheet();
-    defaultStyleSheet = parseUASheet(defaultRules);
+    defaultStyleSheet = parseUASheet(htmlUserAgentStyleSheet, sizeof(htmlUserAgentStyleSheet), RenderTheme::theme().extraDefaultStyleSheet());
     defaultStyle->addRulesFromSheet(defaultStyleSheet, screenEval());
     defaultStyle->addRulesFromSheet(parseUASheet(ViewportStyle::viewportStyleSheet()), screenEval());
     defaultPrintStyle->addRulesFromSheet(defaultStyleSheet, printEval());
 
     // Quirks-mode rules.
-    String quirksRules = String(quirksUserAgentStyleSheet, sizeof(quirksUserAgentStyleSheet)) + RenderTheme::theme().extraQuirksStyleSheet();
-    quirksStyleSheet = parseUASheet(quirksRules);
+    quirksStyleSheet = parseUASheet(quirksUserAgentStyleSheet, sizeof(quirksUserAgentStyleSheet), RenderTheme::theme().extraQuirksStyleSheet());
     defaultQuirksStyle->addRulesFromSheet(quirksStyleSheet, screenEval());
 }
 
@@ -136,8 +149,7 @@ void CSSDefaultStyleSheets::ensureDefaultStyleSheetsForElement(Element* element,
 
     // FIXME: We should assert that this sheet only contains rules for <video> and <audio>.
     if (!mediaControlsStyleSheet && (isHTMLVideoElement(element) || element->hasTagName(audioTag))) {
-        String mediaRules = String(mediaControlsUserAgentStyleSheet, sizeof(mediaControlsUserAgentStyleSheet)) + RenderTheme::theme().extraMediaControlsStyleSheet();
-        mediaControlsStyleSheet = parseUASheet(mediaRules);
+        mediaControlsStyleSheet = parseUASheet(mediaControlsUserAgentStyleSheet, sizeof(mediaControlsUserAgentStyleSheet), RenderTheme::theme().extraMediaControlsStyleSheet());
         defaultStyle->addRulesFromSheet(mediaControlsStyleSheet, screenEval());
         defaultPrintStyle->addRulesFromSheet(mediaControlsStyleSheet, printEval());
         changedDefaultStyle = true;
@@ -146,8 +158,7 @@ void CSSDefaultStyleSheets::ensureDefaultStyleSheetsForElement(Element* element,
     // FIXME: This only works because we Force recalc the entire document so the new sheet
     // is loaded for <html> and the correct styles apply to everyone.
     if (!fullscreenStyleSheet && FullscreenElementStack::isFullScreen(&element->document())) {
-        String fullscreenRules = String(fullscreenUserAgentStyleSheet, sizeof(fullscreenUserAgentStyleSheet)) + RenderTheme::theme().extraFullScreenStyleSheet();
-        fullscreenStyleSheet = parseUASheet(fullscreenRules);
+        fullscreenStyleSheet = parseUASheet(fullscreenUserAgentStyleSheet, sizeof(fullscreenUserAgentStyleSheet), RenderTheme::theme().extraFullScreenStyleSheet());
         defaultStyle->addRulesFromSheet(fullscreenStyleSheet, screenEval());
         defaultQuirksStyle->addRulesFromSheet(fullscreenStyleSheet, screenEval());
         changedDefaultStyle = true;
@@ -16,12 +16,50 @@
 #include "common/Clock.h"
 #include "common/config.h"
 #include "common/debug.h"
+#include "common/simple_cache.hpp"
 #include "include/buffer.h"
 
 #define dout_subsys ceph_subsys_auth
 #undef dout_prefix
 #define dout_prefix *_dout << "cephx: "
 
+/*
+ * Clients present the same service ticket on every (re)connect until it
+ * is renewed, so remember the decrypted CephXServiceTicketInfo for recently
+ * seen tickets.  The cache lives on the CephContext and is keyed on the
+ * service, the rotating secret id and the encrypted blob, so no secret
+ * material is copied into it and a hit costs one hash lookup.
+ */
+static const size_t CEPHX_TICKET_CACHE_SIZE = 1024;
+
+struct CephXTicketCache {
+  SimpleLRU<std::string, CephXServiceTicketInfo> lru;
+
+  explicit CephXTicketCache(CephContext *cct)
+    : lru(CEPHX_TICKET_CACHE_SIZE) {}
+};
+
+static CephXTicketCache *get_ticket_cache(CephContext *cct)
+{
+  CephXTicketCache *cache;
+  cct->lookup_or_create_singleton_object<CephXTicketCache>(
+    cache, "cephx::ticket_cache");
+  return cache;
+}
+
+static std::string ticket_cache_key(uint32_t service_id,
+				    const CephXTicketBlob& ticket)
+{
+  std::string key;
+  key.reserve(sizeof(service_id) + sizeof(ticket.secret_id) +
+	      ticket.blob.length());
+  key.append((const char *)&service_id, sizeof(service_id));
+  key.append((const char *)&ticket.secret_id, sizeof(ticket.secret_id));
+  for (const auto& p : ticket.blob.buffers())
+    key.append(p.c_str(), p.length());
+  return key;
+}
+
 
 
 void cephx_calc_client_server_challenge(CephContext *cct, CryptoKey& secret, uint64_t server_challenge, 
@@ -434,10 +472,20 @@ bool cephx_verify_authorizer(CephContext *cct, KeyStore *keys,
     }
   }
   std::string error;
-  if (!service_secret.get_secret().length())
+  if (!service_secret.get_secret().length()) {
     error = "invalid key";  // Bad key?
-  else
-    decode_decrypt_enc_bl(cct, ticket_info, service_secret, ticket.blob, error);
+  } else {
+    CephXTicketCache *cache = get_ticket_cache(cct);
+    std::string cache_key = ticket_cache_key(service_id, ticket);
+    if (!cache->lru.lookup(cache_key, &ticket_info) ||
+	ticket_info.ticket.expires < ceph_clock_now()) {
+      decode_decrypt_enc_bl(cct, ticket_info, service_secret, ticket.blob, error);
+      if (error.empty())
+	cache->lru.add(cache_key, ticket_info);
+    } else {
+      ldout(cct, 20) << "verify_authorizer using cached ticket info" << dendl;
+    }
+  }
   if (!error.empty()) {
     ldout(cct, 0) << "verify_authorizer could not decrypt ticket info: error: "
       << error << dendl;
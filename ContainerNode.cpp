@@ -50,7 +50,7 @@ namespace WebCore {
 
 static void dispatchChildInsertionEvents(Node*);
 static void dispatchChildRemovalEvents(Node*);
-static void updateTreeAfterInsertion(ContainerNode*, Node*);
+static void updateTreeAfterInsertion(ContainerNode*, Node*, ChildListMutationScope&);
 
 ChildNodesLazySnapshot* ChildNodesLazySnapshot::latestSnapshot = 0;
 
@@ -246,7 +246,7 @@ void ContainerNode::insertBefore(PassRefPtr<Node> newChild, Node* refChild, Exce
 
         insertBeforeCommon(next.get(), child);
 
-        updateTreeAfterInsertion(this, child);
+        updateTreeAfterInsertion(this, child, mutation);
     }
 
     dispatchSubtreeModifiedEvent();
@@ -381,7 +381,7 @@ void ContainerNode::replaceChild(PassRefPtr<Node> newChild, Node* oldChild, Exce
                 appendChildToContainer(child, this);
         }
 
-        updateTreeAfterInsertion(this, child);
+        updateTreeAfterInsertion(this, child, mutation);
     }
 
     dispatchSubtreeModifiedEvent();
@@ -615,7 +615,7 @@ void ContainerNode::appendChild(PassRefPtr<Node> newChild, ExceptionState& es)
             appendChildToContainer(child, this);
         }
 
-        updateTreeAfterInsertion(this, child);
+        updateTreeAfterInsertion(this, child, mutation);
     }
 
     dispatchSubtreeModifiedEvent();
@@ -959,12 +959,15 @@ static void dispatchChildRemovalEvents(Node* child)
     }
 }
 
-static void updateTreeAfterInsertion(ContainerNode* parent, Node* child)
+// The caller's mutation scope is reused so that inserting the children of a
+// large DocumentFragment doesn't look up the mutation record accumulator
+// once per child.
+static void updateTreeAfterInsertion(ContainerNode* parent, Node* child, ChildListMutationScope& mutation)
 {
     ASSERT(parent->refCount());
     ASSERT(child->refCount());
 
-    ChildListMutationScope(parent).childAdded(child);
+    mutation.childAdded(child);
 
     parent->childrenChanged(false, child->previousSibling(), child->nextSibling(), 1);
 
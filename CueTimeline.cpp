@@ -11,6 +11,7 @@
 #include "core/html/track/TextTrack.h"
 #include "core/html/track/TextTrackCue.h"
 #include "core/html/track/TextTrackCueList.h"
+#include "platform/heap/HeapAllocator.h"
 #include "platform/wtf/NonCopyingSort.h"
 
 namespace blink {
@@ -195,13 +196,23 @@ void CueTimeline::UpdateActiveCues(double movie_time) {
   size_t missed_cues_size = missed_cues.size();
   size_t previous_cues_size = previous_cues.size();
 
+  // The steps below repeatedly ask whether a cue is in the current or the
+  // previous set. Index both sets once so that these checks stay constant
+  // time when a track has many simultaneously active cues.
+  HeapHashSet<Member<TextTrackCue>> current_cue_set;
+  for (const auto& current_cue : current_cues)
+    current_cue_set.insert(current_cue.Data());
+  HeapHashSet<Member<TextTrackCue>> previous_cue_set;
+  for (const auto& previous_cue : previous_cues)
+    previous_cue_set.insert(previous_cue.Data());
+
   // 6 - If all of the cues in current cues have their text track cue active
   // flag set, none of the cues in other cues have their text track cue active
   // flag set, and missed cues is empty, then abort these steps.
   bool active_set_changed = missed_cues_size;
 
   for (size_t i = 0; !active_set_changed && i < previous_cues_size; ++i) {
-    if (!current_cues.Contains(previous_cues[i]) &&
+    if (!current_cue_set.Contains(previous_cues[i].Data()) &&
         previous_cues[i].Data()->IsActive())
       active_set_changed = true;
   }
@@ -228,7 +239,7 @@ void CueTimeline::UpdateActiveCues(double movie_time) {
   for (size_t i = 0; !media_element.paused() && i < previous_cues_size; ++i) {
     if (previous_cues[i].Data()->pauseOnExit() &&
         previous_cues[i].Data()->IsActive() &&
-        !current_cues.Contains(previous_cues[i]))
+        !current_cue_set.Contains(previous_cues[i].Data()))
       media_element.pause();
   }
 
@@ -270,7 +281,7 @@ void CueTimeline::UpdateActiveCues(double movie_time) {
     // 10 - For each text track cue in other cues that has its text
     // track cue active flag set prepare an event named exit for the
     // TextTrackCue object with the text track cue end time.
-    if (!current_cues.Contains(previous_cue)) {
+    if (!current_cue_set.Contains(previous_cue.Data())) {
       event_tasks.push_back(
           std::make_pair(previous_cue.Data()->endTime(), previous_cue.Data()));
     }
@@ -280,7 +291,7 @@ void CueTimeline::UpdateActiveCues(double movie_time) {
     // 11 - For each text track cue in current cues that does not have its
     // text track cue active flag set, prepare an event named enter for the
     // TextTrackCue object with the text track cue start time.
-    if (!previous_cues.Contains(current_cue)) {
+    if (!previous_cue_set.Contains(current_cue.Data())) {
       event_tasks.push_back(
           std::make_pair(current_cue.Data()->startTime(), current_cue.Data()));
     }
@@ -344,7 +355,7 @@ void CueTimeline::UpdateActiveCues(double movie_time) {
     cue.Data()->SetIsActive(true);
 
   for (const auto& previous_cue : previous_cues) {
-    if (!current_cues.Contains(previous_cue)) {
+    if (!current_cue_set.Contains(previous_cue.Data())) {
       TextTrackCue* cue = previous_cue.Data();
       cue->SetIsActive(false);
       cue->RemoveDisplayTree();
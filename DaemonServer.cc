@@ -430,11 +430,11 @@ bool DaemonServer::handle_report(MMgrReport *m)
     return true;
   }
 
-  // Look up the DaemonState
-  DaemonStatePtr daemon;
-  if (daemon_state.exists(key)) {
+  // Look up the DaemonState; a single get() keeps this to one trip through
+  // the DaemonStateIndex lock per report
+  DaemonStatePtr daemon = daemon_state.get(key);
+  if (daemon) {
     dout(20) << "updating existing DaemonState for " << key << dendl;
-    daemon = daemon_state.get(key);
   } else {
     // we don't know the hostname at this stage, reject MMgrReport here.
     dout(5) << "rejecting report from " << key << ", since we do not have its metadata now."
@@ -498,7 +498,7 @@ bool DaemonServer::handle_report(MMgrReport *m)
     if (daemon->service_daemon) {
       utime_t now = ceph_clock_now();
       if (m->daemon_status) {
-        daemon->service_status = *m->daemon_status;
+        daemon->service_status = std::move(*m->daemon_status);
         daemon->service_status_stamp = now;
       }
       daemon->last_service_beacon = now;
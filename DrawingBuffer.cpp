@@ -62,6 +62,13 @@ namespace {
 
 const float kResourceAdjustedRatio = 0.5;
 
+// Number of released color buffers kept for reuse. Two plain textures are
+// enough to cover a frame that is still queued in the compositor while the
+// previous one is being displayed, so steady 60fps content doesn't allocate.
+// Creation of image backed mailboxes is very expensive, so keep more of them.
+const size_t kColorBufferCacheLimit = 2;
+const size_t kImageColorBufferCacheLimit = 4;
+
 static bool g_should_fail_drawing_buffer_creation_for_testing = false;
 
 }  // namespace
@@ -437,11 +444,9 @@ void DrawingBuffer::MailboxReleasedGpu(RefPtr<ColorBuffer> color_buffer,
     return;
   }
 
-  // Creation of image backed mailboxes is very expensive, so be less
-  // aggressive about pruning them. Pruning is done in FIFO order.
-  size_t cache_limit = 1;
-  if (ShouldUseChromiumImage())
-    cache_limit = 4;
+  // Pruning is done in FIFO order.
+  size_t cache_limit = ShouldUseChromiumImage() ? kImageColorBufferCacheLimit
+                                                : kColorBufferCacheLimit;
   while (recycled_color_buffer_queue_.size() >= cache_limit)
     recycled_color_buffer_queue_.TakeLast();
 
@@ -574,6 +579,8 @@ DrawingBuffer::CreateOrRecycleColorBuffer() {
     DCHECK(recycled->size == size_);
     return recycled;
   }
+  TRACE_EVENT_INSTANT0("blink", "DrawingBuffer::ColorBufferStarved",
+                       TRACE_EVENT_SCOPE_THREAD);
   return CreateColorBuffer(size_);
 }
 
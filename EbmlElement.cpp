@@ -406,6 +406,29 @@ EbmlElement * EbmlElement::FindNextElement(IOCallback & DataStream, const EbmlSe
 
       if (MaxDataSize <= ReadSize)
         break;
+
+      if (ReadIndex > 0 && ReadIndex < 4) {
+        // the first octet already gives the ID length, read the remaining
+        // octets in one call rather than one octet per loop
+        int IdLength = 0;
+        for (int i = 0; i < 4; i++) {
+          if (PossibleIdNSize[0] & (binary(1 << 7) >> i)) {
+            IdLength = i + 1;
+            break;
+          }
+        }
+        if (IdLength > ReadIndex + 1) {
+          uint64 Missing = IdLength - ReadIndex;
+          if (Missing > MaxDataSize - ReadSize)
+            Missing = MaxDataSize - ReadSize;
+          if (DataStream.read(&PossibleIdNSize[ReadIndex], uint32(Missing)) < Missing) {
+            return NULL; // no more data ?
+          }
+          ReadIndex += int(Missing);
+          ReadSize += uint32(Missing);
+          continue;
+        }
+      }
       if (DataStream.read(&PossibleIdNSize[ReadIndex++], 1) == 0) {
         return NULL; // no more data ?
       }
@@ -196,6 +196,56 @@ bool GIFLZWContext::outputRow(GIFRow::const_iterator rowBegin)
     return true;
 }
 
+namespace {
+
+// Holds a copy of the decoder state that doLZW() updates for every code. The
+// output row buffer is written through an unsigned char pointer, which may
+// alias any object, so updating the GIFLZWContext fields directly would force
+// them to be reloaded from memory after every byte written. The copy lives on
+// the stack and doesn't escape, so it can stay in registers; it's written back
+// when doLZW() returns.
+class LZWDecodeState {
+public:
+    explicit LZWDecodeState(GIFLZWContext& context)
+        : codesize(context.codesize)
+        , codemask(context.codemask)
+        , avail(context.avail)
+        , oldcode(context.oldcode)
+        , firstchar(context.firstchar)
+        , bits(context.bits)
+        , datum(context.datum)
+        , rowIter(context.rowIter)
+        , m_context(context)
+    {
+    }
+
+    ~LZWDecodeState()
+    {
+        m_context.codesize = codesize;
+        m_context.codemask = codemask;
+        m_context.avail = avail;
+        m_context.oldcode = oldcode;
+        m_context.firstchar = firstchar;
+        m_context.bits = bits;
+        m_context.datum = datum;
+        m_context.rowIter = rowIter;
+    }
+
+    int codesize;
+    int codemask;
+    int avail;
+    int oldcode;
+    unsigned char firstchar;
+    int bits;
+    int datum;
+    GIFRow::iterator rowIter;
+
+private:
+    GIFLZWContext& m_context;
+};
+
+} // namespace
+
 // Perform Lempel-Ziv-Welch decoding.
 // Returns true if decoding was successful. In this case the block will have been completely consumed and/or rowsRemaining will be 0.
 // Otherwise, decoding failed; returns false in this case, which will always cause the GIFImageReader to set the "decode failed" flag.
@@ -206,24 +256,27 @@ bool GIFLZWContext::doLZW(const unsigned char* block, size_t bytesInBlock)
     if (rowIter == rowBuffer.end())
         return true;
 
+    LZWDecodeState state(*this);
+    const int dataSize = m_frameContext->dataSize();
+
     for (const unsigned char* ch = block; bytesInBlock-- > 0; ch++) {
         // Feed the next byte into the decoder's 32-bit input buffer.
-        datum += ((int) *ch) << bits;
-        bits += 8;
+        state.datum += ((int) *ch) << state.bits;
+        state.bits += 8;
 
         // Check for underflow of decoder's 32-bit input buffer.
-        while (bits >= codesize) {
+        while (state.bits >= state.codesize) {
             // Get the leading variable-length symbol from the data stream.
-            int code = datum & codemask;
-            datum >>= codesize;
-            bits -= codesize;
+            int code = state.datum & state.codemask;
+            state.datum >>= state.codesize;
+            state.bits -= state.codesize;
 
             // Reset the dictionary to its original state, if requested.
             if (code == clearCode) {
-                codesize = m_frameContext->dataSize() + 1;
-                codemask = (1 << codesize) - 1;
-                avail = clearCode + 2;
-                oldcode = -1;
+                state.codesize = dataSize + 1;
+                state.codemask = (1 << state.codesize) - 1;
+                state.avail = clearCode + 2;
+                state.oldcode = -1;
                 continue;
             }
 
@@ -237,19 +290,19 @@ bool GIFLZWContext::doLZW(const unsigned char* block, size_t bytesInBlock)
 
             const int tempCode = code;
             unsigned short codeLength = 0;
-            if (code < avail) {
+            if (code < state.avail) {
                 // This is a pre-existing code, so we already know what it
                 // encodes.
                 codeLength = suffixLength[code];
-                rowIter += codeLength;
-            } else if (code == avail && oldcode != -1) {
+                state.rowIter += codeLength;
+            } else if (code == state.avail && state.oldcode != -1) {
                 // This is a new code just being added to the dictionary.
                 // It must encode the contents of the previous code, plus
                 // the first character of the previous code again.
-                codeLength = suffixLength[oldcode] + 1;
-                rowIter += codeLength;
-                *--rowIter = firstchar;
-                code = oldcode;
+                codeLength = suffixLength[state.oldcode] + 1;
+                state.rowIter += codeLength;
+                *--state.rowIter = state.firstchar;
+                code = state.oldcode;
             } else {
                 // This is an invalid code. The dictionary is just initialized
                 // and the code is incomplete. We don't know how to handle
@@ -258,34 +311,34 @@ bool GIFLZWContext::doLZW(const unsigned char* block, size_t bytesInBlock)
             }
 
             while (code >= clearCode) {
-                *--rowIter = suffix[code];
+                *--state.rowIter = suffix[code];
                 code = prefix[code];
             }
 
-            *--rowIter = firstchar = suffix[code];
+            *--state.rowIter = state.firstchar = suffix[code];
 
             // Define a new codeword in the dictionary as long as we've read
             // more than one value from the stream.
-            if (avail < MAX_DICTIONARY_ENTRIES && oldcode != -1) {
-                prefix[avail] = oldcode;
-                suffix[avail] = firstchar;
-                suffixLength[avail] = suffixLength[oldcode] + 1;
-                ++avail;
+            if (state.avail < MAX_DICTIONARY_ENTRIES && state.oldcode != -1) {
+                prefix[state.avail] = state.oldcode;
+                suffix[state.avail] = state.firstchar;
+                suffixLength[state.avail] = suffixLength[state.oldcode] + 1;
+                ++state.avail;
 
                 // If we've used up all the codewords of a given length
                 // increase the length of codewords by one bit, but don't
                 // exceed the specified maximum codeword size.
-                if (!(avail & codemask) && avail < MAX_DICTIONARY_ENTRIES) {
-                    ++codesize;
-                    codemask += avail;
+                if (!(state.avail & state.codemask) && state.avail < MAX_DICTIONARY_ENTRIES) {
+                    ++state.codesize;
+                    state.codemask += state.avail;
                 }
             }
-            oldcode = tempCode;
-            rowIter += codeLength;
+            state.oldcode = tempCode;
+            state.rowIter += codeLength;
 
             // Output as many rows as possible.
             GIFRow::iterator rowBegin = rowBuffer.begin();
-            for (; rowBegin + width <= rowIter; rowBegin += width) {
+            for (; rowBegin + width <= state.rowIter; rowBegin += width) {
                 if (!outputRow(rowBegin))
                     return false;
                 rowsRemaining--;
@@ -295,9 +348,9 @@ bool GIFLZWContext::doLZW(const unsigned char* block, size_t bytesInBlock)
 
             if (rowBegin != rowBuffer.begin()) {
                 // Move the remaining bytes to the beginning of the buffer.
-                const size_t bytesToCopy = rowIter - rowBegin;
+                const size_t bytesToCopy = state.rowIter - rowBegin;
                 memcpy(rowBuffer.begin(), rowBegin, bytesToCopy);
-                rowIter = rowBuffer.begin() + bytesToCopy;
+                state.rowIter = rowBuffer.begin() + bytesToCopy;
             }
         }
     }
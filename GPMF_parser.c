@@ -991,6 +991,37 @@ GPMF_ERR GPMF_FormattedData(GPMF_stream *ms, void *buffer, uint32_t buffersize,
 	data = (uint8_t *)datatemp;							\
 }
 
+// Bulk conversion for a simple input type into float or double output. The per-element
+// scales are resolved up front, so the inner loop no longer switches on the input, output
+// and scale types for every value.
+#define MACRO_BSWAP_CAST_BULK_SCALE(swap, inputcast, tempcast)		\
+{																	\
+	tempcast temp, *datatemp = (tempcast *)data;					\
+	uint32_t n, e;													\
+	if (outputType == GPMF_TYPE_FLOAT)								\
+	{																\
+		float *tmp = (float *)output;								\
+		for (n = 0; n < read_samples; n++)							\
+			for (e = 0; e < elements; e++)							\
+			{														\
+				temp = swap(*datatemp);								\
+				datatemp++;											\
+				*tmp++ = (float)*((inputcast *)&temp) / fscales[e];	\
+			}														\
+	}																\
+	else															\
+	{																\
+		double *tmp = (double *)output;								\
+		for (n = 0; n < read_samples; n++)							\
+			for (e = 0; e < elements; e++)							\
+			{														\
+				temp = swap(*datatemp);								\
+				datatemp++;											\
+				*tmp++ = (double)*((inputcast *)&temp) / dscales[e];\
+			}														\
+	}																\
+}
+
 GPMF_ERR GPMF_ScaledData(GPMF_stream *ms, void *buffer, uint32_t buffersize, uint32_t sample_offset, uint32_t read_samples, GPMF_SampleType outputType)
 {
 	if (ms && buffer)
@@ -1117,6 +1148,48 @@ GPMF_ERR GPMF_ScaledData(GPMF_stream *ms, void *buffer, uint32_t buffersize, uin
 			}
 		}
 
+		// 64-bit inputs keep the per-element conversion below.
+		if (type != GPMF_TYPE_COMPLEX && type != GPMF_TYPE_SIGNED_64BIT_INT && type != GPMF_TYPE_UNSIGNED_64BIT_INT &&
+			elements <= 64 && elements * inputtypesize == sample_size &&
+			(outputType == GPMF_TYPE_FLOAT || outputType == GPMF_TYPE_DOUBLE))
+		{
+			float fscales[64];
+			double dscales[64];
+			uint32_t i;
+
+			for (i = 0; i < elements; i++)
+			{
+				uint8_t *scaledata8 = (uint8_t *)scaledata + (scalecount > 1 ? i * scaletypesize : 0);
+
+				switch (scaletype)
+				{
+				case GPMF_TYPE_SIGNED_BYTE:		dscales[i] = (double)*((int8_t *)scaledata8);	break;
+				case GPMF_TYPE_UNSIGNED_BYTE:	dscales[i] = (double)*((uint8_t *)scaledata8);	break;
+				case GPMF_TYPE_SIGNED_SHORT:	dscales[i] = (double)*((int16_t *)scaledata8);	break;
+				case GPMF_TYPE_UNSIGNED_SHORT:	dscales[i] = (double)*((uint16_t *)scaledata8);	break;
+				case GPMF_TYPE_SIGNED_LONG:		dscales[i] = (double)*((int32_t *)scaledata8);	break;
+				case GPMF_TYPE_UNSIGNED_LONG:	dscales[i] = (double)*((uint32_t *)scaledata8);	break;
+				case GPMF_TYPE_FLOAT:			dscales[i] = (double)*((float *)scaledata8);	break;
+				default: return GPMF_ERROR_TYPE_NOT_SUPPORTED;
+				}
+				fscales[i] = (float)dscales[i]; // same as casting the scale directly, as the double is exact
+			}
+
+			switch (type)
+			{
+			case GPMF_TYPE_FLOAT:  MACRO_BSWAP_CAST_BULK_SCALE(BYTESWAP32, float, uint32_t) break;
+			case GPMF_TYPE_SIGNED_BYTE:  MACRO_BSWAP_CAST_BULK_SCALE(NOSWAP8, int8_t, uint8_t) break;
+			case GPMF_TYPE_UNSIGNED_BYTE:  MACRO_BSWAP_CAST_BULK_SCALE(NOSWAP8, uint8_t, uint8_t) break;
+			case GPMF_TYPE_SIGNED_SHORT:  MACRO_BSWAP_CAST_BULK_SCALE(BYTESWAP16, int16_t, uint16_t) break;
+			case GPMF_TYPE_UNSIGNED_SHORT:  MACRO_BSWAP_CAST_BULK_SCALE(BYTESWAP16, uint16_t, uint16_t) break;
+			case GPMF_TYPE_SIGNED_LONG:  MACRO_BSWAP_CAST_BULK_SCALE(BYTESWAP32, int32_t, uint32_t) break;
+			case GPMF_TYPE_UNSIGNED_LONG:  MACRO_BSWAP_CAST_BULK_SCALE(BYTESWAP32, uint32_t, uint32_t) break;
+			default:
+				return GPMF_ERROR_TYPE_NOT_SUPPORTED;
+			}
+			break;
+		}
+
 		while (read_samples--)
 		{
 			uint32_t i;
@@ -270,9 +270,8 @@ bool HTMLFrameOwnerElement::LoadOrRedirectSubframe(
     const KURL& url,
     const AtomicString& frame_name,
     bool replace_current_item) {
-  UpdateContainerPolicy();
-
   if (ContentFrame()) {
+    UpdateContainerPolicy();
     ContentFrame()->Navigate(GetDocument(), url, replace_current_item,
                              UserGestureStatus::kNone);
     return true;
@@ -285,6 +284,11 @@ bool HTMLFrameOwnerElement::LoadOrRedirectSubframe(
       Page::kMaxNumberOfFrames)
     return false;
 
+  // Only parse the container policy once we know a frame will be created for
+  // it; pages that hit the frame limit would otherwise parse the allow
+  // attribute of every excess iframe for nothing.
+  UpdateContainerPolicy();
+
   LocalFrame* child_frame =
       GetDocument().GetFrame()->Client()->CreateFrame(frame_name, this);
   DCHECK_EQ(ContentFrame(), child_frame);
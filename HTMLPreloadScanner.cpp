@@ -659,6 +659,10 @@ void TokenPreloadScanner::scanCommon(const Token& token, const SegmentedString&
         return;
     }
     case HTMLToken::EndTag: {
+        // End tags only matter while inside one of the elements below, so
+        // most of them can skip the tag name lookup entirely.
+        if (!m_templateCount && !m_inStyle && !m_inScript && !m_inPicture)
+            return;
         const StringImpl* tagImpl = tagImplFor(token.data());
         if (match(tagImpl, templateTag)) {
             if (m_templateCount)
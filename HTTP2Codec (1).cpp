@@ -602,7 +602,9 @@ folly::Optional<ErrorCode> HTTP2Codec::parseHeadersCheckConcurrentStreams(
 void HTTP2Codec::onHeader(const folly::fbstring& name,
                           const folly::fbstring& value) {
   if (decodeInfo_.onHeader(name, value)) {
-    if (name == "user-agent" && userAgent_.empty()) {
+    // Test the flag first: once the user-agent is known this is the only
+    // per-header cost left here.
+    if (userAgent_.empty() && name == "user-agent") {
       userAgent_ = value.toStdString();
     }
   } else {
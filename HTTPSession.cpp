@@ -2087,14 +2087,18 @@ unique_ptr<IOBuf> HTTPSession::getNextToSend(bool* cork, bool* eom) {
       txnMaxToSend = egressBodySizeLimit_;
       toSend = txnMaxToSend / nextEgressResults_.front().second;
     }
-    // split allowed by relative weight, with some minimum
-    for (auto txnPair: nextEgressResults_) {
-      uint32_t txnAllowed = txnPair.second * toSend;
+    // split allowed by relative weight, with some minimum.  Budget a
+    // transaction leaves unused (e.g. it had less body pending than its
+    // share) is carried over to the next one in this round, so that a few
+    // small transactions don't leave most of toSend idle.
+    uint32_t carry = 0;
+    for (const auto& txnPair: nextEgressResults_) {
+      uint32_t txnAllowed = txnPair.second * toSend + carry;
       if (nextEgressResults_.size() > 1) {
-        CHECK_LE(txnAllowed, egressBodySizeLimit_);
+        txnAllowed = std::min(txnAllowed, egressBodySizeLimit_);
       }
       if (connFlowControl_) {
-        CHECK_LE(txnAllowed, connFlowControl_->getAvailableSend());
+        txnAllowed = std::min(txnAllowed, connFlowControl_->getAvailableSend());
       }
       if (txnAllowed == 0) {
         // The ratio * toSend was so small this txn gets nothing.
@@ -2104,7 +2108,10 @@ unique_ptr<IOBuf> HTTPSession::getNextToSend(bool* cork, bool* eom) {
 
       VLOG(4) << *this << " egressing txnID=" << txnPair.first->getID() <<
         " allowed=" << txnAllowed;
+      auto before = writeBuf_.chainLength();
       txnPair.first->onWriteReady(txnAllowed, txnPair.second);
+      auto used = writeBuf_.chainLength() - before;
+      carry = used < txnAllowed ? txnAllowed - used : 0;
     }
     nextEgressResults_.clear();
     // it can be empty because of HTTPTransaction rate limiting.  We should
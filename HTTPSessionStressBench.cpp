@@ -0,0 +1,413 @@
+/*
+ *  Copyright (c) 2017-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <folly/Conv.h>
+#include <folly/SocketAddress.h>
+#include <folly/init/Init.h>
+#include <folly/io/IOBuf.h>
+#include <folly/io/async/AsyncServerSocket.h>
+#include <folly/io/async/AsyncSocket.h>
+#include <folly/io/async/EventBase.h>
+#include <folly/io/async/ScopedEventBaseThread.h>
+#include <folly/portability/GMock.h>
+#include <folly/synchronization/Baton.h>
+#include <gflags/gflags.h>
+#include <proxygen/lib/http/HTTPConnector.h>
+#include <proxygen/lib/http/codec/HTTP2Codec.h>
+#include <proxygen/lib/http/codec/test/TestUtils.h>
+#include <proxygen/lib/http/session/HTTPDownstreamSession.h>
+#include <proxygen/lib/http/session/HTTPUpstreamSession.h>
+#include <proxygen/lib/http/session/test/HTTPSessionMocks.h>
+#include <proxygen/lib/utils/TestUtils.h>
+
+// Load generator for the HTTP/2 session layer. Each server thread owns its
+// own listening socket, timer and controller, and each connection is pinned
+// to one client thread, so nothing is shared between EventBases while the
+// load runs. Reports requests/s, latency percentiles and wire bytes per
+// request for N connections x M concurrent streams over loopback sockets.
+
+DEFINE_int32(server_threads, 2, "Number of server EventBase threads");
+DEFINE_int32(client_threads, 2, "Number of client EventBase threads");
+DEFINE_int32(connections, 16, "Number of HTTP/2 connections");
+DEFINE_int32(streams, 32, "Concurrent streams per connection");
+DEFINE_int32(requests, 10000, "Requests sent on each connection");
+DEFINE_int32(body_size, 1024, "Response body size in bytes");
+
+using namespace folly;
+using namespace proxygen;
+using namespace testing;
+using std::chrono::steady_clock;
+
+namespace {
+
+class StressServerHandler : public HTTPTransactionHandler {
+ public:
+  explicit StressServerHandler(const IOBuf& body) : body_(body) {}
+
+  void setTransaction(HTTPTransaction* txn) noexcept override {
+    txn_ = txn;
+  }
+  void detachTransaction() noexcept override {
+    delete this;
+  }
+  void onHeadersComplete(std::unique_ptr<HTTPMessage>) noexcept override {}
+  void onBody(std::unique_ptr<IOBuf>) noexcept override {}
+  void onTrailers(std::unique_ptr<HTTPHeaders>) noexcept override {}
+  void onEOM() noexcept override {
+    HTTPMessage resp;
+    resp.setStatusCode(200);
+    resp.setStatusMessage("OK");
+    resp.getHeaders().set(HTTP_HEADER_CONTENT_LENGTH,
+                          folly::to<std::string>(body_.length()));
+    txn_->sendHeaders(resp);
+    txn_->sendBody(body_.clone());
+    txn_->sendEOM();
+  }
+  void onUpgrade(UpgradeProtocol) noexcept override {}
+  void onError(const HTTPException&) noexcept override {
+    txn_->sendAbort();
+  }
+  void onEgressPaused() noexcept override {}
+  void onEgressResumed() noexcept override {}
+
+ private:
+  const IOBuf& body_;
+  HTTPTransaction* txn_{nullptr};
+};
+
+/**
+ * Accepts connections on one EventBase and serves each of them with an
+ * HTTPDownstreamSession running a real HTTP2Codec.
+ */
+class StressServer : public AsyncServerSocket::AcceptCallback {
+ public:
+  explicit StressServer(EventBase* evb)
+    : evb_(evb),
+      body_(IOBuf::CREATE, FLAGS_body_size),
+      transactionTimeouts_(makeTimeoutSet(evb)) {
+    memset(body_.writableData(), 'a', FLAGS_body_size);
+    body_.append(FLAGS_body_size);
+    ON_CALL(controller_, getRequestHandler(_, _))
+      .WillByDefault(InvokeWithoutArgs([this] {
+            return new StressServerHandler(body_);
+          }));
+    ON_CALL(controller_, attachSession(_))
+      .WillByDefault(InvokeWithoutArgs([this] { ++liveSessions_; }));
+    ON_CALL(controller_, detachSession(_))
+      .WillByDefault(InvokeWithoutArgs([this] {
+            if (--liveSessions_ == 0 && stopping_) {
+              drained_.post();
+            }
+          }));
+    socket_ = AsyncServerSocket::newSocket(evb_);
+    socket_->bind(0);
+    socket_->listen(1024);
+    socket_->addAcceptCallback(this, evb_);
+    socket_->startAccepting();
+    socket_->getAddress(&address_);
+  }
+
+  const SocketAddress& getAddress() const {
+    return address_;
+  }
+
+  // Stop accepting; drained_ is posted once every session has gone away.
+  void stop() {
+    socket_.reset();
+    stopping_ = true;
+    if (liveSessions_ == 0) {
+      drained_.post();
+    }
+  }
+
+  void waitForDrain() {
+    drained_.wait();
+  }
+
+  void connectionAccepted(
+      int fd, const SocketAddress& clientAddr) noexcept override {
+    AsyncSocket::UniquePtr sock(new AsyncSocket(evb_, fd));
+    sock->setNoDelay(true);
+    SocketAddress localAddr;
+    sock->getLocalAddress(&localAddr);
+    auto session = new HTTPDownstreamSession(
+      transactionTimeouts_.get(),
+      std::move(sock),
+      localAddr, clientAddr,
+      &controller_,
+      std::make_unique<HTTP2Codec>(TransportDirection::DOWNSTREAM),
+      wangle::TransportInfo(),
+      nullptr);
+    session->startNow();
+  }
+
+  void acceptError(const std::exception& ex) noexcept override {
+    LOG(ERROR) << "accept failed: " << ex.what();
+  }
+
+ private:
+  EventBase* evb_;
+  IOBuf body_;
+  HHWheelTimer::UniquePtr transactionTimeouts_;
+  NiceMock<MockController> controller_;
+  std::shared_ptr<AsyncServerSocket> socket_;
+  SocketAddress address_;
+  uint32_t liveSessions_{0};
+  bool stopping_{false};
+  Baton<> drained_;
+};
+
+class StressClient;
+
+class StressClientHandler : public HTTPTransactionHandler {
+ public:
+  explicit StressClientHandler(StressClient* client)
+    : client_(client), start_(steady_clock::now()) {}
+
+  void setTransaction(HTTPTransaction*) noexcept override {}
+  void detachTransaction() noexcept override {
+    delete this;
+  }
+  void onHeadersComplete(std::unique_ptr<HTTPMessage>) noexcept override {}
+  void onBody(std::unique_ptr<IOBuf>) noexcept override {}
+  void onTrailers(std::unique_ptr<HTTPHeaders>) noexcept override {}
+  void onEOM() noexcept override;
+  void onUpgrade(UpgradeProtocol) noexcept override {}
+  void onError(const HTTPException& error) noexcept override;
+  void onEgressPaused() noexcept override {}
+  void onEgressResumed() noexcept override {}
+
+ private:
+  StressClient* client_;
+  steady_clock::time_point start_;
+};
+
+/**
+ * Drives one HTTP/2 connection: keeps FLAGS_streams requests in flight until
+ * FLAGS_requests have completed, then closes the session.
+ */
+class StressClient : public HTTPConnector::Callback,
+                     public HTTPSession::InfoCallback {
+ public:
+  StressClient(EventBase* evb, HHWheelTimer* timer,
+               const SocketAddress& address)
+    : evb_(evb),
+      address_(address),
+      connector_(this, timer) {
+    connector_.setPlaintextProtocol(http2::kProtocolCleartextString);
+    latencies_.reserve(FLAGS_requests);
+  }
+
+  void start() {
+    connector_.connect(evb_, address_, std::chrono::milliseconds(5000));
+  }
+
+  void connectSuccess(HTTPUpstreamSession* session) override {
+    session_ = session;
+    session_->setInfoCallback(this);
+    for (int32_t i = 0; i < FLAGS_streams; ++i) {
+      sendRequest();
+    }
+  }
+
+  void connectError(const AsyncSocketException& ex) override {
+    LOG(ERROR) << "connect to " << address_ << " failed: " << ex.what();
+    done_.post();
+  }
+
+  void onResponse(steady_clock::duration latency) {
+    latencies_.push_back(latency);
+    if (latencies_.size() + errors_ == static_cast<size_t>(FLAGS_requests)) {
+      finish();
+    } else {
+      sendRequest();
+    }
+  }
+
+  void onRequestError() {
+    if (latencies_.size() + ++errors_ ==
+        static_cast<size_t>(FLAGS_requests)) {
+      finish();
+    } else {
+      // Retry from the event loop rather than recursing: sendRequest() calls
+      // back into onRequestError() when it can't open a transaction, so a
+      // server failing every request would otherwise grow the stack.
+      evb_->runInLoop([this] { sendRequest(); });
+    }
+  }
+
+  void onDestroy(const HTTPSessionBase&) override {
+    session_ = nullptr;
+    done_.post();
+  }
+
+  void waitForDone() {
+    done_.wait();
+  }
+
+  const std::vector<steady_clock::duration>& getLatencies() const {
+    return latencies_;
+  }
+
+  size_t getErrors() const {
+    return errors_;
+  }
+
+  size_t getWireBytes() const {
+    return wireBytes_;
+  }
+
+ private:
+  void sendRequest() {
+    if (sent_ == FLAGS_requests || !session_) {
+      return;
+    }
+    ++sent_;
+    auto handler = new StressClientHandler(this);
+    auto txn = session_->newTransaction(handler);
+    if (!txn) {
+      delete handler;
+      onRequestError();
+      return;
+    }
+    txn->sendHeadersWithEOM(getGetRequest());
+  }
+
+  void finish() {
+    auto transport = session_->getTransport();
+    wireBytes_ = transport->getRawBytesWritten() +
+      transport->getRawBytesReceived();
+    session_->closeWhenIdle();
+  }
+
+  EventBase* evb_;
+  SocketAddress address_;
+  HTTPConnector connector_;
+  HTTPUpstreamSession* session_{nullptr};
+  int32_t sent_{0};
+  size_t errors_{0};
+  size_t wireBytes_{0};
+  std::vector<steady_clock::duration> latencies_;
+  Baton<> done_;
+};
+
+void StressClientHandler::onEOM() noexcept {
+  client_->onResponse(steady_clock::now() - start_);
+}
+
+void StressClientHandler::onError(const HTTPException&) noexcept {
+  client_->onRequestError();
+}
+
+double percentileUs(const std::vector<steady_clock::duration>& sorted,
+                    double pct) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  size_t idx = std::min(sorted.size() - 1,
+                        static_cast<size_t>(pct * sorted.size()));
+  return std::chrono::duration<double, std::micro>(sorted[idx]).count();
+}
+
+}
+
+int main(int argc, char** argv) {
+  testing::InitGoogleMock(&argc, argv);
+  folly::init(&argc, &argv);
+
+  if (FLAGS_server_threads <= 0 || FLAGS_client_threads <= 0) {
+    LOG(ERROR) << "--server_threads and --client_threads must be > 0";
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<ScopedEventBaseThread>> serverThreads;
+  std::vector<std::unique_ptr<StressServer>> servers;
+  for (int32_t i = 0; i < FLAGS_server_threads; ++i) {
+    serverThreads.push_back(std::make_unique<ScopedEventBaseThread>());
+    auto evb = serverThreads.back()->getEventBase();
+    evb->runInEventBaseThreadAndWait([&] {
+        servers.push_back(std::make_unique<StressServer>(evb));
+      });
+  }
+
+  std::vector<std::unique_ptr<ScopedEventBaseThread>> clientThreads;
+  std::vector<HHWheelTimer::UniquePtr> clientTimers;
+  for (int32_t i = 0; i < FLAGS_client_threads; ++i) {
+    clientThreads.push_back(std::make_unique<ScopedEventBaseThread>());
+    auto evb = clientThreads.back()->getEventBase();
+    evb->runInEventBaseThreadAndWait([&] {
+        clientTimers.push_back(makeTimeoutSet(evb));
+      });
+  }
+
+  std::vector<std::unique_ptr<StressClient>> clients;
+  for (int32_t i = 0; i < FLAGS_connections; ++i) {
+    auto evb = clientThreads[i % clientThreads.size()]->getEventBase();
+    auto timer = clientTimers[i % clientTimers.size()].get();
+    auto& address = servers[i % servers.size()]->getAddress();
+    clients.push_back(std::make_unique<StressClient>(evb, timer, address));
+  }
+
+  auto start = steady_clock::now();
+  for (size_t i = 0; i < clients.size(); ++i) {
+    auto evb = clientThreads[i % clientThreads.size()]->getEventBase();
+    auto client = clients[i].get();
+    evb->runInEventBaseThread([client] { client->start(); });
+  }
+  for (auto& client: clients) {
+    client->waitForDone();
+  }
+  auto elapsed = std::chrono::duration<double>(
+    steady_clock::now() - start).count();
+
+  std::vector<steady_clock::duration> latencies;
+  size_t errors = 0;
+  size_t wireBytes = 0;
+  for (auto& client: clients) {
+    auto& clientLatencies = client->getLatencies();
+    latencies.insert(latencies.end(), clientLatencies.begin(),
+                     clientLatencies.end());
+    errors += client->getErrors();
+    wireBytes += client->getWireBytes();
+  }
+  std::sort(latencies.begin(), latencies.end());
+
+  for (size_t i = 0; i < servers.size(); ++i) {
+    auto evb = serverThreads[i]->getEventBase();
+    evb->runInEventBaseThreadAndWait([&] { servers[i]->stop(); });
+    servers[i]->waitForDrain();
+    evb->runInEventBaseThreadAndWait([&] { servers[i].reset(); });
+  }
+  for (size_t i = 0; i < clientThreads.size(); ++i) {
+    clientThreads[i]->getEventBase()->runInEventBaseThreadAndWait([&] {
+        clientTimers[i].reset();
+      });
+  }
+  clients.clear();
+
+  size_t completed = latencies.size();
+  printf("connections=%d streams=%d server_threads=%d client_threads=%d\n",
+         FLAGS_connections, FLAGS_streams, FLAGS_server_threads,
+         FLAGS_client_threads);
+  printf("completed=%zu errors=%zu elapsed=%.3fs\n",
+         completed, errors, elapsed);
+  printf("requests/s=%.0f\n", elapsed > 0 ? completed / elapsed : 0);
+  printf("latency_us p50=%.1f p99=%.1f max=%.1f\n",
+         percentileUs(latencies, 0.50), percentileUs(latencies, 0.99),
+         percentileUs(latencies, 1.0));
+  printf("wire_bytes/request=%.1f\n",
+         completed ? static_cast<double>(wireBytes) / completed : 0);
+  return errors == 0 ? 0 : 1;
+}
@@ -35,6 +35,7 @@
 #include "hb.h"
 #include "platform/LayoutUnit.h"
 #include "platform/RuntimeEnabledFeatures.h"
+#include "platform/TraceEvent.h"
 #include "platform/fonts/Character.h"
 #include "platform/fonts/Font.h"
 #include "platform/fonts/GlyphBuffer.h"
@@ -43,11 +44,13 @@
 #include "platform/text/TextBreakIterator.h"
 #include "wtf/Compiler.h"
 #include "wtf/MathExtras.h"
+#include "wtf/StringHasher.h"
 #include "wtf/unicode/Unicode.h"
 
+#include <algorithm>
 #include <list>
-#include <map>
-#include <string>
+#include <string.h>
+#include <unordered_map>
 #include <unicode/normlzr.h>
 #include <unicode/uchar.h>
 #include <unicode/uscript.h>
@@ -79,36 +82,41 @@ private:
 };
 
 
-static const unsigned cHarfBuzzCacheMaxSize = 256;
+// The run cache is bounded by the memory held by its entries (mostly the
+// shaped HarfBuzz buffers) rather than by the number of entries.
+static const size_t cHarfBuzzCacheMaxBytes = 512 * 1024;
+// Hit and miss counts are traced once per this many lookups.
+static const unsigned cHarfBuzzCacheStatisticsInterval = 1024;
 
-struct CachedShapingResultsLRUNode;
 struct CachedShapingResults;
-typedef std::map<std::wstring, CachedShapingResults*> CachedShapingResultsMap;
-typedef std::list<CachedShapingResultsLRUNode*> CachedShapingResultsLRU;
+typedef std::unordered_multimap<unsigned, CachedShapingResults*> CachedShapingResultsMap;
+typedef std::list<CachedShapingResults*> CachedShapingResultsLRU;
 
 struct CachedShapingResults {
-    CachedShapingResults(hb_buffer_t* harfBuzzBuffer, const Font* runFont, hb_direction_t runDir, const String& newLocale);
+    CachedShapingResults(hb_buffer_t* harfBuzzBuffer, const Font* runFont, hb_direction_t runDir, const String& newLocale,
+        const UChar* runText, unsigned runLength, unsigned runHash);
     ~CachedShapingResults();
 
+    bool matches(const UChar* runText, unsigned runLength, const Font* runFont, hb_direction_t runDir) const;
+    size_t byteSize() const;
+
     hb_buffer_t* buffer;
     Font font;
     hb_direction_t dir;
     String locale;
+    String text;
+    unsigned hash;
     CachedShapingResultsLRU::iterator lru;
 };
 
-struct CachedShapingResultsLRUNode {
-    CachedShapingResultsLRUNode(const CachedShapingResultsMap::iterator& cacheEntry);
-    ~CachedShapingResultsLRUNode();
-
-    CachedShapingResultsMap::iterator entry;
-};
-
-CachedShapingResults::CachedShapingResults(hb_buffer_t* harfBuzzBuffer, const Font* fontData, hb_direction_t dirData, const String& newLocale)
+CachedShapingResults::CachedShapingResults(hb_buffer_t* harfBuzzBuffer, const Font* fontData, hb_direction_t dirData, const String& newLocale,
+    const UChar* runText, unsigned runLength, unsigned runHash)
     : buffer(harfBuzzBuffer)
     , font(*fontData)
     , dir(dirData)
     , locale(newLocale)
+    , text(runText, runLength)
+    , hash(runHash)
 {
 }
 
@@ -117,91 +125,181 @@ CachedShapingResults::~CachedShapingResults()
     hb_buffer_destroy(buffer);
 }
 
-CachedShapingResultsLRUNode::CachedShapingResultsLRUNode(const CachedShapingResultsMap::iterator& cacheEntry)
-    : entry(cacheEntry)
+bool CachedShapingResults::matches(const UChar* runText, unsigned runLength, const Font* runFont, hb_direction_t runDir) const
 {
+    if (text.length() != runLength || dir != runDir)
+        return false;
+    if (runLength && memcmp(text.characters16(), runText, runLength * sizeof(UChar)))
+        return false;
+    return font == *runFont;
 }
 
-CachedShapingResultsLRUNode::~CachedShapingResultsLRUNode()
+size_t CachedShapingResults::byteSize() const
 {
+    return sizeof(*this) + text.length() * sizeof(UChar)
+        + hb_buffer_get_length(buffer) * (sizeof(hb_glyph_info_t) + sizeof(hb_glyph_position_t));
 }
 
+// Approximate recent access frequency of run text hashes, used as a
+// TinyLFU-style admission filter: a count-min sketch of small saturating
+// counters that are halved periodically so that old popularity fades.
+class ShapingFrequencySketch {
+public:
+    ShapingFrequencySketch()
+        : m_additions(0)
+    {
+        memset(m_counters, 0, sizeof(m_counters));
+    }
+
+    void record(unsigned hash)
+    {
+        for (unsigned row = 0; row < cDepth; ++row) {
+            uint8_t& counter = m_counters[row][index(hash, row)];
+            if (counter < cMaxCount)
+                ++counter;
+        }
+        if (++m_additions == cAgingInterval)
+            age();
+    }
+
+    unsigned frequency(unsigned hash) const
+    {
+        unsigned result = cMaxCount;
+        for (unsigned row = 0; row < cDepth; ++row)
+            result = std::min<unsigned>(result, m_counters[row][index(hash, row)]);
+        return result;
+    }
+
+private:
+    static const unsigned cDepth = 4;
+    static const unsigned cWidth = 1024;
+    static const unsigned cMaxCount = 15;
+    static const unsigned cAgingInterval = 10 * cWidth;
+
+    static unsigned index(unsigned hash, unsigned row)
+    {
+        static const unsigned seeds[cDepth] = { 0x9E3779B1, 0x85EBCA77, 0xC2B2AE3D, 0x27D4EB2F };
+        unsigned mixed = hash * seeds[row];
+        return (mixed ^ (mixed >> 16)) & (cWidth - 1);
+    }
+
+    void age()
+    {
+        for (unsigned row = 0; row < cDepth; ++row) {
+            for (unsigned i = 0; i < cWidth; ++i)
+                m_counters[row][i] >>= 1;
+        }
+        m_additions /= 2;
+    }
+
+    uint8_t m_counters[cDepth][cWidth];
+    unsigned m_additions;
+};
+
 class HarfBuzzRunCache {
 public:
     HarfBuzzRunCache();
     ~HarfBuzzRunCache();
 
-    CachedShapingResults* find(const std::wstring& key) const;
+    CachedShapingResults* find(const UChar* text, unsigned length, unsigned hash, const Font*, hb_direction_t);
     void remove(CachedShapingResults* node);
-    void moveToBack(CachedShapingResults* node);
-    bool insert(const std::wstring& key, CachedShapingResults* run);
+    void insert(CachedShapingResults* run);
 
 private:
+    void recordLookup(bool hit);
+
     CachedShapingResultsMap m_harfBuzzRunMap;
     CachedShapingResultsLRU m_harfBuzzRunLRU;
+    ShapingFrequencySketch m_frequencySketch;
+    size_t m_byteSize;
+    unsigned m_hits;
+    unsigned m_misses;
 };
 
 
 HarfBuzzRunCache::HarfBuzzRunCache()
+    : m_byteSize(0)
+    , m_hits(0)
+    , m_misses(0)
 {
 }
 
 HarfBuzzRunCache::~HarfBuzzRunCache()
 {
-    for (CachedShapingResultsMap::iterator it = m_harfBuzzRunMap.begin(); it != m_harfBuzzRunMap.end(); ++it)
-        delete it->second;
     for (CachedShapingResultsLRU::iterator it = m_harfBuzzRunLRU.begin(); it != m_harfBuzzRunLRU.end(); ++it)
         delete *it;
 }
 
-bool HarfBuzzRunCache::insert(const std::wstring& key, CachedShapingResults* data)
+// Takes ownership of |data|. When the cache is full, the least recently used
+// entries are only evicted in favour of a run that has been looked up more
+// often recently; otherwise |data| is dropped.
+void HarfBuzzRunCache::insert(CachedShapingResults* data)
 {
-    std::pair<CachedShapingResultsMap::iterator, bool> results =
-        m_harfBuzzRunMap.insert(CachedShapingResultsMap::value_type(key, data));
-
-    if (!results.second)
-        return false;
-
-    CachedShapingResultsLRUNode* node = new CachedShapingResultsLRUNode(results.first);
-
-    m_harfBuzzRunLRU.push_back(node);
-    data->lru = --m_harfBuzzRunLRU.end();
+    size_t size = data->byteSize();
+    if (size > cHarfBuzzCacheMaxBytes) {
+        delete data;
+        return;
+    }
 
-    if (m_harfBuzzRunMap.size() > cHarfBuzzCacheMaxSize) {
-        CachedShapingResultsLRUNode* lru = m_harfBuzzRunLRU.front();
-        CachedShapingResults* foo = lru->entry->second;
-        m_harfBuzzRunMap.erase(lru->entry);
-        m_harfBuzzRunLRU.pop_front();
-        delete foo;
-        delete lru;
+    unsigned candidateFrequency = m_frequencySketch.frequency(data->hash);
+    while (m_byteSize + size > cHarfBuzzCacheMaxBytes) {
+        CachedShapingResults* victim = m_harfBuzzRunLRU.front();
+        if (candidateFrequency <= m_frequencySketch.frequency(victim->hash)) {
+            delete data;
+            return;
+        }
+        remove(victim);
     }
 
-    return true;
+    m_harfBuzzRunMap.insert(CachedShapingResultsMap::value_type(data->hash, data));
+    m_harfBuzzRunLRU.push_back(data);
+    data->lru = --m_harfBuzzRunLRU.end();
+    m_byteSize += size;
 }
 
-inline CachedShapingResults* HarfBuzzRunCache::find(const std::wstring& key) const
+// Looks up the shaping result for |text| with |font| and |dir| without
+// copying the text, and marks it as most recently used.
+CachedShapingResults* HarfBuzzRunCache::find(const UChar* text, unsigned length, unsigned hash, const Font* font, hb_direction_t dir)
 {
-    CachedShapingResultsMap::const_iterator it = m_harfBuzzRunMap.find(key);
-
-    return it != m_harfBuzzRunMap.end() ? it->second : 0;
+    m_frequencySketch.record(hash);
+
+    std::pair<CachedShapingResultsMap::iterator, CachedShapingResultsMap::iterator> range = m_harfBuzzRunMap.equal_range(hash);
+    for (CachedShapingResultsMap::iterator it = range.first; it != range.second; ++it) {
+        CachedShapingResults* node = it->second;
+        if (node->matches(text, length, font, dir)) {
+            m_harfBuzzRunLRU.splice(m_harfBuzzRunLRU.end(), m_harfBuzzRunLRU, node->lru);
+            recordLookup(true);
+            return node;
+        }
+    }
+    recordLookup(false);
+    return 0;
 }
 
-inline void HarfBuzzRunCache::remove(CachedShapingResults* node)
+void HarfBuzzRunCache::remove(CachedShapingResults* node)
 {
-    CachedShapingResultsLRUNode* lruNode = *node->lru;
-
+    std::pair<CachedShapingResultsMap::iterator, CachedShapingResultsMap::iterator> range = m_harfBuzzRunMap.equal_range(node->hash);
+    for (CachedShapingResultsMap::iterator it = range.first; it != range.second; ++it) {
+        if (it->second == node) {
+            m_harfBuzzRunMap.erase(it);
+            break;
+        }
+    }
     m_harfBuzzRunLRU.erase(node->lru);
-    m_harfBuzzRunMap.erase(lruNode->entry);
-    delete lruNode;
+    m_byteSize -= node->byteSize();
     delete node;
 }
 
-inline void HarfBuzzRunCache::moveToBack(CachedShapingResults* node)
+void HarfBuzzRunCache::recordLookup(bool hit)
 {
-    CachedShapingResultsLRUNode* lruNode = *node->lru;
-    m_harfBuzzRunLRU.erase(node->lru);
-    m_harfBuzzRunLRU.push_back(lruNode);
-    node->lru = --m_harfBuzzRunLRU.end();
+    if (hit)
+        ++m_hits;
+    else
+        ++m_misses;
+    if ((m_hits + m_misses) % cHarfBuzzCacheStatisticsInterval)
+        return;
+    TRACE_COUNTER2("blink", "HarfBuzzRunCache", "hits", m_hits, "misses", m_misses);
+    TRACE_COUNTER1("blink", "HarfBuzzRunCacheBytes", m_byteSize);
 }
 
 HarfBuzzRunCache& harfBuzzRunCache()
@@ -835,9 +933,11 @@ bool HarfBuzzShaper::shapeHarfBuzzRuns()
         hb_buffer_set_direction(harfBuzzBuffer.get(), currentRun->direction());
 
         const UChar* src = m_normalizedBuffer.get() + currentRun->startIndex();
-        std::wstring key(src, src + currentRun->numCharacters());
+        unsigned numCharacters = currentRun->numCharacters();
+        unsigned textHash = StringHasher::computeHash(src, numCharacters);
 
-        CachedShapingResults* cachedResults = runCache.find(key);
+        CachedShapingResults* cachedResults = runCache.find(src, numCharacters,
+            textHash, m_font, currentRun->direction());
         if (cachedResults) {
             if (isValidCachedResult(m_font, currentRun->direction(),
                 localeString, cachedResults)) {
@@ -845,7 +945,6 @@ bool HarfBuzzShaper::shapeHarfBuzzRuns()
                 setGlyphPositionsForHarfBuzzRun(currentRun,
                     cachedResults->buffer, previousRun);
                 hb_buffer_clear_contents(harfBuzzBuffer.get());
-                runCache.moveToBack(cachedResults);
                 previousRun = currentRun;
                 continue;
             }
@@ -870,7 +969,8 @@ bool HarfBuzzShaper::shapeHarfBuzzRuns()
         currentRun->applyShapeResult(harfBuzzBuffer.get());
         setGlyphPositionsForHarfBuzzRun(currentRun, harfBuzzBuffer.get(), previousRun);
 
-        runCache.insert(key, new CachedShapingResults(harfBuzzBuffer.get(), m_font, currentRun->direction(), localeString));
+        runCache.insert(new CachedShapingResults(harfBuzzBuffer.get(), m_font,
+            currentRun->direction(), localeString, src, numCharacters, textHash));
 
         harfBuzzBuffer.set(hb_buffer_create());
 
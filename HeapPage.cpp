@@ -30,6 +30,7 @@
 
 #include "platform/heap/HeapPage.h"
 
+#include "base/bits.h"
 #include "base/trace_event/process_memory_dump.h"
 #include "platform/MemoryCoordinator.h"
 #include "platform/ScriptForbiddenScope.h"
@@ -45,9 +46,11 @@
 #include "platform/instrumentation/tracing/web_process_memory_dump.h"
 #include "public/platform/Platform.h"
 #include "wtf/Assertions.h"
+#include "wtf/Atomics.h"
 #include "wtf/AutoReset.h"
 #include "wtf/ContainerAnnotations.h"
 #include "wtf/CurrentTime.h"
+#include "wtf/DynamicAnnotations.h"
 #include "wtf/LeakAnnotations.h"
 #include "wtf/allocator/Partitions.h"
 
@@ -808,23 +811,21 @@ Address NormalPageArena::lazySweepPages(size_t allocationSize,
   Address result = nullptr;
   while (m_firstUnsweptPage) {
     BasePage* page = m_firstUnsweptPage;
-    if (page->isEmpty()) {
-      page->unlink(&m_firstUnsweptPage);
-      page->removeFromHeap();
-    } else {
-      // Sweep a page and move the page from m_firstUnsweptPages to
-      // m_firstPages.
-      page->sweep();
-      page->unlink(&m_firstUnsweptPage);
-      page->link(&m_firstPage);
-      page->markAsSwept();
+    // Sweep a page and move the page from m_firstUnsweptPages to
+    // m_firstPages. An empty page is not released here: it has no objects to
+    // finalize and its payload satisfies any normal allocation, so reusing it
+    // ends the sweep right away instead of freeing the page, sweeping (and
+    // finalizing) more pages and then possibly allocating a fresh one.
+    page->sweep();
+    page->unlink(&m_firstUnsweptPage);
+    page->link(&m_firstPage);
+    page->markAsSwept();
 
-      // For NormalPage, stop lazy sweeping once we find a slot to
-      // allocate a new object.
-      result = allocateFromFreeList(allocationSize, gcInfoIndex);
-      if (result)
-        break;
-    }
+    // For NormalPage, stop lazy sweeping once we find a slot to
+    // allocate a new object.
+    result = allocateFromFreeList(allocationSize, gcInfoIndex);
+    if (result)
+      break;
   }
   return result;
 }
@@ -872,6 +873,30 @@ void NormalPageArena::setAllocationPoint(Address point, size_t size) {
   m_lastRemainingAllocationSize = m_remainingAllocationSize = size;
 }
 
+// Process-wide counts of normal-page slow-path allocations, reported as a
+// counter in GC traces. They are only maintained while the disabled-by-default
+// blink_gc category is enabled, so the slow path pays nothing otherwise.
+static int s_outOfLineAllocationCount = 0;
+static int s_outOfLineAllocationFreeListMissCount = 0;
+
+static void reportOutOfLineAllocation(bool servedByFreeList) {
+  static const unsigned char* traceCategoryEnabled = 0;
+  WTF_ANNOTATE_BENIGN_RACE(&traceCategoryEnabled, "trace_event category");
+  if (!traceCategoryEnabled)
+    traceCategoryEnabled = TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED(
+        TRACE_DISABLED_BY_DEFAULT("blink_gc"));
+  if (!*traceCategoryEnabled)
+    return;
+  int allocations = atomicIncrement(&s_outOfLineAllocationCount);
+  int freeListMisses =
+      servedByFreeList
+          ? acquireLoad(&s_outOfLineAllocationFreeListMissCount)
+          : atomicIncrement(&s_outOfLineAllocationFreeListMissCount);
+  TRACE_COUNTER2(TRACE_DISABLED_BY_DEFAULT("blink_gc"),
+                 "NormalPageArena::outOfLineAllocate", "allocations",
+                 allocations, "freeListMisses", freeListMisses);
+}
+
 Address NormalPageArena::outOfLineAllocate(size_t allocationSize,
                                            size_t gcInfoIndex) {
   ASSERT(allocationSize > remainingAllocationSize());
@@ -884,6 +909,7 @@ Address NormalPageArena::outOfLineAllocate(size_t allocationSize,
   // 2. Try to allocate from a free list.
   updateRemainingAllocationSize();
   Address result = allocateFromFreeList(allocationSize, gcInfoIndex);
+  reportOutOfLineAllocation(result);
   if (result)
     return result;
 
@@ -1208,12 +1234,8 @@ void FreeList::clear() {
 
 int FreeList::bucketIndexForSize(size_t size) {
   ASSERT(size > 0);
-  int index = -1;
-  while (size) {
-    size >>= 1;
-    index++;
-  }
-  return index;
+  ASSERT(size < blinkPagePayloadSize());
+  return base::bits::Log2Floor(static_cast<uint32_t>(size));
 }
 
 bool FreeList::takeSnapshot(const String& dumpBaseName) {
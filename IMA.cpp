@@ -180,15 +180,19 @@ int IMA::decodeBlockWAVE(const uint8_t *encoded, int16_t *decoded)
 	{
 		for (int c=0; c<channelCount; c++)
 		{
+			// Work on a local copy of the channel state so that it can stay
+			// in registers across the stores to the output buffer.
+			adpcmState state = m_adpcmState[c];
 			int16_t *output = decoded + c;
 			for (int s=0; s<4; s++)
 			{
-				*output = decodeSample(m_adpcmState[c], *encoded & 0xf);
+				uint8_t e = *encoded++;
+				*output = decodeSample(state, e & 0xf);
 				output += channelCount;
-				*output = decodeSample(m_adpcmState[c], *encoded >> 4);
+				*output = decodeSample(state, e >> 4);
 				output += channelCount;
-				encoded++;
 			}
+			m_adpcmState[c] = state;
 		}
 
 		decoded += channelCount * 8;
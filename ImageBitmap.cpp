@@ -155,35 +155,20 @@ static sk_sp<SkImage> newSkImageFromRaster(const SkImageInfo& info,
                                  imagePixels.leakRef());
 }
 
-static void swizzleImageData(unsigned char* srcAddr,
-                             unsigned height,
-                             unsigned bytesPerRow,
-                             bool flipY) {
-  if (flipY) {
-    for (unsigned i = 0; i < height / 2; i++) {
-      unsigned topRowStartPosition = i * bytesPerRow;
-      unsigned bottomRowStartPosition = (height - 1 - i) * bytesPerRow;
-      if (kN32_SkColorType == kBGRA_8888_SkColorType) {  // needs to swizzle
-        for (unsigned j = 0; j < bytesPerRow; j += 4) {
-          std::swap(srcAddr[topRowStartPosition + j],
-                    srcAddr[bottomRowStartPosition + j + 2]);
-          std::swap(srcAddr[topRowStartPosition + j + 1],
-                    srcAddr[bottomRowStartPosition + j + 1]);
-          std::swap(srcAddr[topRowStartPosition + j + 2],
-                    srcAddr[bottomRowStartPosition + j]);
-          std::swap(srcAddr[topRowStartPosition + j + 3],
-                    srcAddr[bottomRowStartPosition + j + 3]);
-        }
-      } else {
-        std::swap_ranges(srcAddr + topRowStartPosition,
-                         srcAddr + topRowStartPosition + bytesPerRow,
-                         srcAddr + bottomRowStartPosition);
-      }
-    }
-  } else {
-    if (kN32_SkColorType == kBGRA_8888_SkColorType)  // needs to swizzle
-      for (unsigned i = 0; i < height * bytesPerRow; i += 4)
-        std::swap(srcAddr[i], srcAddr[i + 2]);
+// Copies |byteCount| bytes of RGBA pixels from |src| to |dst|, swizzling them
+// to kN32 order when that is BGRA.
+static void copyRGBARowToN32(unsigned char* dst,
+                             const unsigned char* src,
+                             unsigned byteCount) {
+  if (kN32_SkColorType != kBGRA_8888_SkColorType) {
+    memcpy(dst, src, byteCount);
+    return;
+  }
+  for (unsigned j = 0; j < byteCount; j += 4) {
+    dst[j] = src[j + 2];
+    dst[j + 1] = src[j + 1];
+    dst[j + 2] = src[j];
+    dst[j + 3] = src[j + 3];
   }
 }
 
@@ -557,76 +542,50 @@ ImageBitmap::ImageBitmap(ImageData* data,
     unsigned srcPixelBytesPerRow = bytesPerPixel * data->size().width();
     unsigned dstPixelBytesPerRow =
         bytesPerPixel * parsedOptions.cropRect.width();
-    sk_sp<SkImage> skImage;
-    if (parsedOptions.cropRect == IntRect(IntPoint(), data->size())) {
-      swizzleImageData(srcAddr, data->size().height(), srcPixelBytesPerRow,
-                       parsedOptions.flipY);
-      skImage =
-          SkImage::MakeRasterCopy(SkPixmap(info, srcAddr, dstPixelBytesPerRow));
-      // restore the original ImageData
-      swizzleImageData(srcAddr, data->size().height(), srcPixelBytesPerRow,
-                       parsedOptions.flipY);
-    } else {
-      RefPtr<ArrayBuffer> dstBuffer = ArrayBuffer::createOrNull(
-          static_cast<unsigned>(parsedOptions.cropRect.height()) *
-              parsedOptions.cropRect.width(),
-          bytesPerPixel);
-      if (!dstBuffer)
-        return;
-      RefPtr<Uint8Array> copiedDataBuffer =
-          Uint8Array::create(dstBuffer, 0, dstBuffer->byteLength());
-      if (!srcRect.isEmpty()) {
-        IntPoint srcPoint = IntPoint(
-            (parsedOptions.cropRect.x() > 0) ? parsedOptions.cropRect.x() : 0,
-            (parsedOptions.cropRect.y() > 0) ? parsedOptions.cropRect.y() : 0);
-        IntPoint dstPoint = IntPoint(
-            (parsedOptions.cropRect.x() >= 0) ? 0 : -parsedOptions.cropRect.x(),
-            (parsedOptions.cropRect.y() >= 0) ? 0
-                                              : -parsedOptions.cropRect.y());
-        int copyHeight = data->size().height() - srcPoint.y();
-        if (parsedOptions.cropRect.height() < copyHeight)
-          copyHeight = parsedOptions.cropRect.height();
-        int copyWidth = data->size().width() - srcPoint.x();
-        if (parsedOptions.cropRect.width() < copyWidth)
-          copyWidth = parsedOptions.cropRect.width();
-        for (int i = 0; i < copyHeight; i++) {
-          unsigned srcStartCopyPosition =
-              (i + srcPoint.y()) * srcPixelBytesPerRow +
-              srcPoint.x() * bytesPerPixel;
-          unsigned srcEndCopyPosition =
-              srcStartCopyPosition + copyWidth * bytesPerPixel;
-          unsigned dstStartCopyPosition;
-          if (parsedOptions.flipY)
-            dstStartCopyPosition =
-                (parsedOptions.cropRect.height() - 1 - dstPoint.y() - i) *
-                    dstPixelBytesPerRow +
-                dstPoint.x() * bytesPerPixel;
-          else
-            dstStartCopyPosition = (dstPoint.y() + i) * dstPixelBytesPerRow +
-                                   dstPoint.x() * bytesPerPixel;
-          for (unsigned j = 0; j < srcEndCopyPosition - srcStartCopyPosition;
-               j++) {
-            // swizzle when necessary
-            if (kN32_SkColorType == kBGRA_8888_SkColorType) {
-              if (j % 4 == 0)
-                copiedDataBuffer->data()[dstStartCopyPosition + j] =
-                    srcAddr[srcStartCopyPosition + j + 2];
-              else if (j % 4 == 2)
-                copiedDataBuffer->data()[dstStartCopyPosition + j] =
-                    srcAddr[srcStartCopyPosition + j - 2];
-              else
-                copiedDataBuffer->data()[dstStartCopyPosition + j] =
-                    srcAddr[srcStartCopyPosition + j];
-            } else {
-              copiedDataBuffer->data()[dstStartCopyPosition + j] =
-                  srcAddr[srcStartCopyPosition + j];
-            }
-          }
-        }
+    // Copy the cropped rows into a new buffer in one pass, flipping and
+    // swizzling as we go. This also covers the uncropped case, so the
+    // ImageData itself is never modified.
+    RefPtr<ArrayBuffer> dstBuffer = ArrayBuffer::createOrNull(
+        static_cast<unsigned>(parsedOptions.cropRect.height()) *
+            parsedOptions.cropRect.width(),
+        bytesPerPixel);
+    if (!dstBuffer)
+      return;
+    RefPtr<Uint8Array> copiedDataBuffer =
+        Uint8Array::create(dstBuffer, 0, dstBuffer->byteLength());
+    if (!srcRect.isEmpty()) {
+      IntPoint srcPoint = IntPoint(
+          (parsedOptions.cropRect.x() > 0) ? parsedOptions.cropRect.x() : 0,
+          (parsedOptions.cropRect.y() > 0) ? parsedOptions.cropRect.y() : 0);
+      IntPoint dstPoint = IntPoint(
+          (parsedOptions.cropRect.x() >= 0) ? 0 : -parsedOptions.cropRect.x(),
+          (parsedOptions.cropRect.y() >= 0) ? 0 : -parsedOptions.cropRect.y());
+      int copyHeight = data->size().height() - srcPoint.y();
+      if (parsedOptions.cropRect.height() < copyHeight)
+        copyHeight = parsedOptions.cropRect.height();
+      int copyWidth = data->size().width() - srcPoint.x();
+      if (parsedOptions.cropRect.width() < copyWidth)
+        copyWidth = parsedOptions.cropRect.width();
+      for (int i = 0; i < copyHeight; i++) {
+        unsigned srcStartCopyPosition =
+            (i + srcPoint.y()) * srcPixelBytesPerRow +
+            srcPoint.x() * bytesPerPixel;
+        unsigned dstStartCopyPosition;
+        if (parsedOptions.flipY)
+          dstStartCopyPosition =
+              (parsedOptions.cropRect.height() - 1 - dstPoint.y() - i) *
+                  dstPixelBytesPerRow +
+              dstPoint.x() * bytesPerPixel;
+        else
+          dstStartCopyPosition = (dstPoint.y() + i) * dstPixelBytesPerRow +
+                                 dstPoint.x() * bytesPerPixel;
+        copyRGBARowToN32(copiedDataBuffer->data() + dstStartCopyPosition,
+                         srcAddr + srcStartCopyPosition,
+                         copyWidth * bytesPerPixel);
       }
-      skImage = newSkImageFromRaster(info, std::move(copiedDataBuffer),
-                                     dstPixelBytesPerRow);
     }
+    sk_sp<SkImage> skImage = newSkImageFromRaster(
+        info, std::move(copiedDataBuffer), dstPixelBytesPerRow);
     if (!skImage)
       return;
     if (parsedOptions.shouldScaleInput)
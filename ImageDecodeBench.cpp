@@ -5,13 +5,18 @@
 #ifdef WTF
 
 Provides a minimal wrapping of the Blink image decoders. Used to perform
-a non-threaded, memory-to-memory image decode using micro second accuracy
-clocks to measure image decode time. Optionally applies color correction
-during image decoding on supported platforms (default off). Usage:
+memory-to-memory image decodes using micro second accuracy clocks to measure
+image decode time. Optionally applies color correction during image decoding
+on supported platforms (default off). Usage:
 
   % ninja -C /out/Release image_decode_bench &&
      ./out/Release/image_decode_bench file [iterations]
 
+Given a directory, every image in it is decoded, optionally on several threads
+(--threads=N), and throughput in MP/s, average decode time and, for packetized
+decodes, time to first row are reported per codec with the peak memory of the
+process. --json writes the same results as JSON for regression tracking.
+
 FIXME: Consider adding md5 checksum support to WTF. Use it to compute the
 decoded image frame md5 and output that value.
 
@@ -29,6 +34,11 @@ http://crbug.com/398235#c103 and http://crbug.com/258324#c5
 #include "public/web/WebKit.h"
 #include "wtf/OwnPtr.h"
 #include "wtf/PassRefPtr.h"
+#include "wtf/Threading.h"
+#include "wtf/ThreadingPrimitives.h"
+#include "wtf/Vector.h"
+#include "wtf/text/WTFString.h"
+#include <algorithm>
 
 #if defined(_WIN32)
 #if defined(WIN32_LEAN_AND_MEAN)
@@ -40,6 +50,8 @@ http://crbug.com/398235#c103 and http://crbug.com/258324#c5
 #define stat(x,y) _stat(x,y)
 typedef struct _stat sttype;
 #else
+#include <dirent.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 typedef struct stat sttype;
@@ -265,11 +277,30 @@ PassRefPtr<SharedBuffer> readFile(const char* fileName)
     return SharedBuffer::create(buffer.get(), fileSize);
 }
 
-bool decodeImageData(SharedBuffer* data, bool colorCorrection, size_t packetSize)
+struct DecodeResult {
+    DecodeResult()
+        : decodeTime(0.0)
+        , timeToFirstRow(-1.0)
+        , pixels(0)
+    {
+    }
+
+    double decodeTime;
+    // Time until the first frame had any decoded rows, or negative if the image
+    // was decoded in one packet and the measurement does not apply.
+    double timeToFirstRow;
+    uint64_t pixels;
+};
+
+bool decodeImageData(SharedBuffer* data, bool colorCorrection, size_t packetSize, DecodeResult& result)
 {
+    double startTime = getCurrentTime();
+
     OwnPtr<ImageDecoder> decoder = ImageDecoder::create(*data,
         ImageDecoder::AlphaPremultiplied, colorCorrection ?
             ImageDecoder::GammaAndColorProfileApplied : ImageDecoder::GammaAndColorProfileIgnored);
+    if (!decoder)
+        return false;
 
     if (!packetSize) {
         bool allDataReceived = true;
@@ -281,6 +312,8 @@ bool decodeImageData(SharedBuffer* data, bool colorCorrection, size_t packetSize
                 return false;
         }
 
+        result.decodeTime = getCurrentTime() - startTime;
+        result.pixels = static_cast<uint64_t>(decoder->size().width()) * decoder->size().height() * frameCount;
         return !decoder->failed();
     }
 
@@ -299,39 +332,311 @@ bool decodeImageData(SharedBuffer* data, bool colorCorrection, size_t packetSize
 
         int frameCount = decoder->frameCount();
         for (int i = 0; i < frameCount; ++i) {
-            if (!decoder->frameBufferAtIndex(i))
+            ImageFrame* frame = decoder->frameBufferAtIndex(i);
+            if (!frame)
                 break;
+            if (!i && result.timeToFirstRow < 0 && frame->status() != ImageFrame::FrameEmpty)
+                result.timeToFirstRow = getCurrentTime() - startTime;
         }
 
         if (allDataReceived || decoder->failed())
             break;
     }
 
+    result.decodeTime = getCurrentTime() - startTime;
+    result.pixels = static_cast<uint64_t>(decoder->size().width()) * decoder->size().height() * decoder->frameCount();
     return !decoder->failed();
 }
 
-int main(int argc, char* argv[])
+// An image from the corpus, and the decode results accumulated for it over all
+// iterations and threads.
+
+struct BenchImage {
+    BenchImage(const String& fileName, PassRefPtr<SharedBuffer> data, const String& codec)
+        : fileName(fileName)
+        , data(data)
+        , codec(codec)
+        , decodes(0)
+        , totalTime(0.0)
+        , totalTimeToFirstRow(0.0)
+        , firstRowSamples(0)
+        , pixels(0)
+        , failed(false)
+    {
+    }
+
+    String fileName;
+    RefPtr<SharedBuffer> data;
+    String codec;
+    size_t decodes;
+    double totalTime;
+    double totalTimeToFirstRow;
+    size_t firstRowSamples;
+    uint64_t pixels;
+    bool failed;
+};
+
+struct BenchState {
+    BenchState()
+        : colorCorrection(false)
+        , packetSize(0)
+        , iterations(1)
+        , nextJob(0)
+    {
+    }
+
+    Vector<OwnPtr<BenchImage>> images;
+    bool colorCorrection;
+    size_t packetSize;
+    size_t iterations;
+
+    Mutex lock;
+    size_t nextJob;
+};
+
+// Each job is one decode of one image; threads pull jobs until all iterations
+// of every image are done so that slow images do not leave threads idle.
+
+static void decodeThreadMain(void* argument)
 {
-    char* name = argv[0];
+    BenchState* state = static_cast<BenchState*>(argument);
+    const size_t totalJobs = state->images.size() * state->iterations;
 
-    // If the platform supports color correction, allow it to be controlled.
+    while (true) {
+        size_t job;
+        {
+            MutexLocker locker(state->lock);
+            job = state->nextJob++;
+        }
+        if (job >= totalJobs)
+            return;
 
-    bool applyColorCorrection = false;
+        BenchImage& image = *state->images[job % state->images.size()];
 
-#if USE(QCMSLIB)
-    if (argc >= 2 && strcmp(argv[1], "--color-correct") == 0)
-        applyColorCorrection = (--argc, ++argv, true);
+        // SharedBuffer is not thread-safe, so each job decodes its own copy
+        // of the image data. The copy is made before the decode is timed.
+        RefPtr<SharedBuffer> data;
+        {
+            MutexLocker locker(state->lock);
+            data = SharedBuffer::create(image.data->data(), image.data->size());
+        }
+
+        DecodeResult result;
+        bool decoded = decodeImageData(data.get(), state->colorCorrection, state->packetSize, result);
+
+        MutexLocker locker(state->lock);
+        if (!decoded) {
+            image.failed = true;
+            continue;
+        }
+        image.decodes++;
+        image.totalTime += result.decodeTime;
+        image.pixels += result.pixels;
+        if (result.timeToFirstRow >= 0) {
+            image.totalTimeToFirstRow += result.timeToFirstRow;
+            image.firstRowSamples++;
+        }
+    }
+}
+
+static size_t peakResidentSetSizeKB()
+{
+#if defined(_WIN32)
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage))
+        return 0;
+#if OS(MACOSX)
+    return usage.ru_maxrss / 1024; // Reported in bytes.
+#else
+    return usage.ru_maxrss; // Reported in kilobytes.
+#endif
+#endif
+}
+
+static bool isDirectory(const char* path)
+{
+    sttype s;
+    if (stat(path, &s))
+        return false;
+    return (s.st_mode & S_IFMT) == S_IFDIR;
+}
 
-    if (argc < 2) {
-        fprintf(stderr, "Usage: %s [--color-correct] file [iterations] [packetSize]\n", name);
-        exit(1);
+static void listCorpusFiles(const char* path, Vector<String>& fileNames)
+{
+    if (!isDirectory(path)) {
+        fileNames.append(String(path));
+        return;
     }
+
+#if defined(_WIN32)
+    fprintf(stderr, "Decoding a corpus directory is not supported on this platform [%s]\n", path);
+    exit(1);
 #else
-    if (argc < 2) {
-        fprintf(stderr, "Usage: %s file [iterations] [packetSize]\n", name);
-        exit(1);
+    DIR* directory = opendir(path);
+    if (!directory) {
+        fprintf(stderr, "Can't open directory %s\n", path);
+        exit(2);
+    }
+
+    while (struct dirent* entry = readdir(directory)) {
+        if (entry->d_name[0] == '.')
+            continue;
+        String fileName = String(path) + "/" + String(entry->d_name);
+        if (!isDirectory(fileName.utf8().data()))
+            fileNames.append(fileName);
+    }
+    closedir(directory);
+
+    std::sort(fileNames.begin(), fileNames.end(), [](const String& a, const String& b) {
+        return codePointCompareLessThan(a, b);
+    });
+#endif
+}
+
+// Per-codec totals reported at the end of the run.
+
+struct CodecStats {
+    explicit CodecStats(const String& codec)
+        : codec(codec)
+        , files(0)
+        , decodes(0)
+        , totalTime(0.0)
+        , totalTimeToFirstRow(0.0)
+        , firstRowSamples(0)
+        , pixels(0)
+    {
+    }
+
+    double megapixelsPerSecond() const { return totalTime > 0 ? pixels / totalTime / 1000000.0 : 0.0; }
+    double averageDecodeTimeMs() const { return decodes ? totalTime * 1000.0 / decodes : 0.0; }
+    double averageTimeToFirstRowMs() const { return firstRowSamples ? totalTimeToFirstRow * 1000.0 / firstRowSamples : -1.0; }
+
+    String codec;
+    size_t files;
+    size_t decodes;
+    double totalTime;
+    double totalTimeToFirstRow;
+    size_t firstRowSamples;
+    uint64_t pixels;
+};
+
+static void collectCodecStats(const BenchState& state, Vector<CodecStats>& stats)
+{
+    for (const auto& image : state.images) {
+        CodecStats* codecStats = nullptr;
+        for (auto& entry : stats) {
+            if (entry.codec == image->codec) {
+                codecStats = &entry;
+                break;
+            }
+        }
+        if (!codecStats) {
+            stats.append(CodecStats(image->codec));
+            codecStats = &stats.last();
+        }
+
+        codecStats->files++;
+        codecStats->decodes += image->decodes;
+        codecStats->totalTime += image->totalTime;
+        codecStats->totalTimeToFirstRow += image->totalTimeToFirstRow;
+        codecStats->firstRowSamples += image->firstRowSamples;
+        codecStats->pixels += image->pixels;
+    }
+}
+
+static void printJSONResults(const Vector<CodecStats>& stats, size_t threads, const BenchState& state, double wallTime)
+{
+    uint64_t totalPixels = 0;
+    for (const auto& entry : stats)
+        totalPixels += entry.pixels;
+
+    printf("{\n");
+    printf("  \"threads\": %lu,\n", static_cast<unsigned long>(threads));
+    printf("  \"iterations\": %lu,\n", static_cast<unsigned long>(state.iterations));
+    printf("  \"packet_size\": %lu,\n", static_cast<unsigned long>(state.packetSize));
+    printf("  \"wall_time_s\": %f,\n", wallTime);
+    printf("  \"megapixels_per_second\": %f,\n", wallTime > 0 ? totalPixels / wallTime / 1000000.0 : 0.0);
+    printf("  \"peak_rss_kb\": %lu,\n", static_cast<unsigned long>(peakResidentSetSizeKB()));
+    printf("  \"codecs\": [");
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const CodecStats& entry = stats[i];
+        printf("%s\n    {\"codec\": \"%s\", \"files\": %lu, \"decodes\": %lu, "
+            "\"megapixels_per_second\": %f, \"average_decode_ms\": %f, \"average_time_to_first_row_ms\": %f}",
+            i ? "," : "", entry.codec.utf8().data(), static_cast<unsigned long>(entry.files), static_cast<unsigned long>(entry.decodes),
+            entry.megapixelsPerSecond(), entry.averageDecodeTimeMs(), entry.averageTimeToFirstRowMs());
     }
+    printf("\n  ]\n}\n");
+}
+
+static void printTextResults(const Vector<CodecStats>& stats, size_t threads, double wallTime)
+{
+    printf("%-6s %6s %8s %10s %12s %12s\n", "codec", "files", "decodes", "MP/s", "avg_ms", "ttfr_ms");
+    for (const auto& entry : stats) {
+        printf("%-6s %6lu %8lu %10.2f %12.3f %12.3f\n", entry.codec.utf8().data(),
+            static_cast<unsigned long>(entry.files), static_cast<unsigned long>(entry.decodes),
+            entry.megapixelsPerSecond(), entry.averageDecodeTimeMs(), entry.averageTimeToFirstRowMs());
+    }
+    printf("threads %lu, wall time %f s, peak rss %lu KB\n", static_cast<unsigned long>(threads), wallTime,
+        static_cast<unsigned long>(peakResidentSetSizeKB()));
+}
+
+static void usage(const char* name)
+{
+#if USE(QCMSLIB)
+    fprintf(stderr, "Usage: %s [--color-correct] [--threads=N] [--json] file|directory [iterations] [packetSize]\n", name);
+#else
+    fprintf(stderr, "Usage: %s [--threads=N] [--json] file|directory [iterations] [packetSize]\n", name);
+#endif
+    exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+    char* name = argv[0];
+
+    // Options come before the positional arguments. If the platform supports
+    // color correction, allow it to be controlled.
+
+    bool applyColorCorrection = false;
+    bool jsonOutput = false;
+    size_t threads = 1;
+
+    while (argc >= 2 && !strncmp(argv[1], "--", 2)) {
+#if USE(QCMSLIB)
+        if (!strcmp(argv[1], "--color-correct")) {
+            applyColorCorrection = (--argc, ++argv, true);
+            continue;
+        }
+#endif
+        if (!strcmp(argv[1], "--json")) {
+            jsonOutput = (--argc, ++argv, true);
+            continue;
+        }
+        if (!strncmp(argv[1], "--threads=", 10)) {
+            char* end = 0;
+            threads = strtol(argv[1] + 10, &end, 10);
+            if (*end != '\0' || !threads) {
+                fprintf(stderr, "--threads should be a positive number of decode threads. "
+                    "The default is 1. You supplied %s\n", argv[1] + 10);
+                exit(1);
+            }
+#if defined(_WIN32)
+            // getCurrentTime() keeps unsynchronized clock state on Windows.
+            if (threads > 1) {
+                fprintf(stderr, "Multi-threaded decoding is not supported on this platform\n");
+                exit(1);
+            }
 #endif
+            --argc, ++argv;
+            continue;
+        }
+        usage(name);
+    }
+
+    if (argc < 2)
+        usage(name);
 
     // Control decode bench iterations and packet size.
 
@@ -386,35 +691,86 @@ int main(int argc, char* argv[])
     ImageDecoder::qcmsOutputDeviceProfile(); // Initialize screen colorProfile.
 #endif
 
-    // Read entire file content to data.
+    // Read the content of every file in the corpus up front, so that file I/O
+    // is not measured. Files no decoder recognizes are skipped.
+
+    bool singleFile = !isDirectory(argv[1]);
+    Vector<String> fileNames;
+    listCorpusFiles(argv[1], fileNames);
+
+    BenchState state;
+    state.colorCorrection = applyColorCorrection;
+    state.packetSize = packetSize;
+    state.iterations = iterations;
+
+    for (const auto& fileName : fileNames) {
+        RefPtr<SharedBuffer> data = readFile(fileName.utf8().data());
+        if (!data.get() || !data->size()) {
+            if (singleFile) {
+                fprintf(stderr, "Error reading image data from [%s]\n", argv[1]);
+                exit(2);
+            }
+            continue;
+        }
 
-    RefPtr<SharedBuffer> data = readFile(argv[1]);
-    if (!data.get() || !data->size()) {
-        fprintf(stderr, "Error reading image data from [%s]\n", argv[1]);
-        exit(2);
+        // Consolidate the SharedBuffer data segments into one, contiguous block of memory.
+        data->data();
+
+        OwnPtr<ImageDecoder> decoder = ImageDecoder::create(*data,
+            ImageDecoder::AlphaPremultiplied, ImageDecoder::GammaAndColorProfileIgnored);
+        if (!decoder) {
+            if (singleFile) {
+                fprintf(stderr, "Image decode failed [%s]\n", argv[1]);
+                exit(3);
+            }
+            fprintf(stderr, "Skipping file of unknown image type [%s]\n", fileName.utf8().data());
+            continue;
+        }
+
+        state.images.append(adoptPtr(new BenchImage(fileName, data.release(), decoder->filenameExtension())));
     }
 
-    // Consolidate the SharedBuffer data segments into one, contiguous block of memory.
-    data->data();
+    if (state.images.isEmpty()) {
+        fprintf(stderr, "No images to decode in [%s]\n", argv[1]);
+        exit(2);
+    }
 
-    // Image decode bench for iterations.
+    // Image decode bench for iterations, spread over the decode threads.
 
-    double totalTime = 0.0;
+    double startTime = getCurrentTime();
+    if (threads == 1) {
+        decodeThreadMain(&state);
+    } else {
+        Vector<ThreadIdentifier> threadIdentifiers;
+        for (size_t i = 0; i < threads; ++i)
+            threadIdentifiers.append(createThread(decodeThreadMain, &state, "ImageDecodeBench"));
+        for (const auto& threadIdentifier : threadIdentifiers)
+            waitForThreadCompletion(threadIdentifier);
+    }
+    double wallTime = getCurrentTime() - startTime;
 
-    for (size_t i = 0; i < iterations; ++i) {
-        double startTime = getCurrentTime();
-        bool decoded = decodeImageData(data.get(), applyColorCorrection, packetSize);
-        double elapsedTime = getCurrentTime() - startTime;
-        totalTime += elapsedTime;
-        if (!decoded) {
-            fprintf(stderr, "Image decode failed [%s]\n", argv[1]);
+    for (const auto& image : state.images) {
+        if (image->failed) {
+            fprintf(stderr, "Image decode failed [%s]\n", image->fileName.utf8().data());
             exit(3);
         }
     }
 
-    // Results to stdout.
+    // Results to stdout. A single file decoded on one thread keeps the original
+    // "total average" output so existing scripts continue to work.
+
+    if (singleFile && threads == 1 && !jsonOutput) {
+        double totalTime = state.images[0]->totalTime;
+        double averageTime = totalTime / static_cast<double>(iterations);
+        printf("%f %f\n", totalTime, averageTime);
+        return 0;
+    }
 
-    double averageTime = totalTime / static_cast<double>(iterations);
-    printf("%f %f\n", totalTime, averageTime);
+    Vector<CodecStats> stats;
+    collectCodecStats(state, stats);
+    if (jsonOutput)
+        printJSONResults(stats, threads, state, wallTime);
+    else
+        printTextResults(stats, threads, wallTime);
     return 0;
 }
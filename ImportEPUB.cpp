@@ -130,12 +130,13 @@ QSharedPointer<Book> ImportEPUB::GetBook(bool extract_metadata)
     LoadInfrastructureFiles();
     // Check for files missing in the Manifest and create warning
     QStringList notInManifest;
-    foreach(QString file_path, m_ZipFilePaths) {
+    const QSet<QString> manifest_paths = m_ManifestFilePaths.toSet();
+    foreach(const QString &file_path, m_ZipFilePaths) {
         // skip mimetype and anything in META-INF and the opf itself
         if (file_path == "mimetype") continue;
         if (file_path.startsWith("META-INF")) continue;
 	if (m_OPFFilePath.contains(file_path)) continue;
-	if (!m_ManifestFilePaths.contains(file_path)) {
+	if (!manifest_paths.contains(file_path)) {
 	    notInManifest << file_path;
 	}
     }
@@ -283,7 +284,7 @@ QHash<QString, QString> ImportEPUB::ParseEncryptionXml()
 
 bool ImportEPUB::BookContentEncrypted(const QHash<QString, QString> &encrypted_files)
 {
-    foreach(QString algorithm, encrypted_files.values()) {
+    foreach(const QString &algorithm, encrypted_files) {
         if (algorithm != ADOBE_FONT_ALGO_ID &&
             algorithm != IDPF_FONT_ALGO_ID) {
             return true;
@@ -303,16 +304,18 @@ void ImportEPUB::AddObfuscatedButUndeclaredFonts(const QHash<QString, QString> &
     }
 
     QDir opf_dir = QFileInfo(m_OPFFilePath).dir();
-    foreach(QString filepath, encrypted_files.keys()) {
+    QSet<QString> manifest_paths = m_Files.values().toSet();
+    foreach(const QString &filepath, encrypted_files.keys()) {
         if (!FONT_EXTENSIONS.contains(QFileInfo(filepath).suffix().toLower())) {
             continue;
         }
 
         // Only add the path to the manifest if it is not already included.
-        QMapIterator<QString, QString> valueSearch(m_Files);
+        const QString relative_path = opf_dir.relativeFilePath(filepath);
 
-        if (!valueSearch.findNext(opf_dir.relativeFilePath(filepath))) {
-            m_Files[ Utility::CreateUUID() ] = opf_dir.relativeFilePath(filepath);
+        if (!manifest_paths.contains(relative_path)) {
+            m_Files[ Utility::CreateUUID() ] = relative_path;
+            manifest_paths.insert(relative_path);
         }
     }
 }
@@ -354,18 +357,21 @@ void ImportEPUB::ProcessFontFiles(const QList<Resource *> &resources,
     }
 
     QHash<QString, QString> new_font_paths_to_algorithms;
-    foreach(QString old_update_path, updates.keys()) {
-        if (!FONT_EXTENSIONS.contains(QFileInfo(old_update_path).suffix().toLower())) {
+    QHashIterator<QString, QString> update(updates);
+    while (update.hasNext()) {
+        update.next();
+        if (!FONT_EXTENSIONS.contains(QFileInfo(update.key()).suffix().toLower())) {
             continue;
         }
 
-        QString new_update_path = updates[ old_update_path ];
-        foreach(QString old_encrypted_path, encrypted_files.keys()) {
-            if (old_update_path == old_encrypted_path) {
-                new_font_paths_to_algorithms[ new_update_path ] = encrypted_files[ old_encrypted_path ];
-            }
+        QHash<QString, QString>::const_iterator encrypted = encrypted_files.constFind(update.key());
+        if (encrypted != encrypted_files.constEnd()) {
+            new_font_paths_to_algorithms[ update.value() ] = encrypted.value();
         }
     }
+
+    // The fonts are independent files, so de-obfuscate them concurrently.
+    QFutureSynchronizer<void> sync;
     foreach(FontResource * font_resource, font_resources) {
         QString match_path = "../" + font_resource->GetRelativePathToOEBPS();
         QString algorithm  = new_font_paths_to_algorithms.value(match_path);
@@ -379,12 +385,10 @@ void ImportEPUB::ProcessFontFiles(const QList<Resource *> &resources,
         // Actually we are de-obfuscating, but the inverse operations of the obfuscation methods
         // are the obfuscation methods themselves. For the math oriented, the obfuscation methods
         // are involutary [ f( f( x ) ) = x ].
-        if (algorithm == ADOBE_FONT_ALGO_ID) {
-            FontObfuscation::ObfuscateFile(font_resource->GetFullPath(), algorithm, m_UuidIdentifierValue);
-        } else {
-            FontObfuscation::ObfuscateFile(font_resource->GetFullPath(), algorithm, m_UniqueIdentifierValue);
-        }
+        const QString &key = algorithm == ADOBE_FONT_ALGO_ID ? m_UuidIdentifierValue : m_UniqueIdentifierValue;
+        sync.addFuture(QtConcurrent::run(FontObfuscation::ObfuscateFile, font_resource->GetFullPath(), algorithm, key));
     }
+    sync.waitForFinished();
 }
 
 void ImportEPUB::ExtractContainer()
@@ -235,6 +235,22 @@ static ColorProfile readColorProfile(jpeg_decompress_struct* info)
 #endif
 }
 
+#if ENABLE(IMAGE_DECODER_DOWN_SAMPLING)
+// Returns the largest IDCT scale denominator libjpeg supports for which the
+// decoded image is still at least |scaledSize|, so the remaining down sampling
+// never has to invent pixels.
+static unsigned dctScaleDenominator(unsigned imageWidth, unsigned imageHeight, const IntSize& scaledSize)
+{
+    for (unsigned denominator = 8; denominator > 1; denominator /= 2) {
+        unsigned outputWidth = (imageWidth + denominator - 1) / denominator;
+        unsigned outputHeight = (imageHeight + denominator - 1) / denominator;
+        if (outputWidth >= static_cast<unsigned>(scaledSize.width()) && outputHeight >= static_cast<unsigned>(scaledSize.height()))
+            return denominator;
+    }
+    return 1;
+}
+#endif
+
 class JPEGImageReader {
     WTF_MAKE_FAST_ALLOCATED;
 public:
@@ -393,6 +409,17 @@ public:
 #endif
             }
 #endif
+#if ENABLE(IMAGE_DECODER_DOWN_SAMPLING)
+            // Have libjpeg do as much of the down sampling as it can in the DCT
+            // domain, so that the IDCT, upsampling and color conversion only run
+            // for the reduced image. outputScanlines() maps the sampled rows and
+            // columns onto the smaller output.
+            if (m_decoder->willDownSample()) {
+                m_info.scale_num = 1;
+                m_info.scale_denom = dctScaleDenominator(m_info.image_width, m_info.image_height, m_decoder->scaledSize());
+            }
+#endif
+
             // Don't allocate a giant and superfluous memory buffer when the
             // image is a sequential JPEG.
             m_info.buffered_image = jpeg_has_multiple_scans(&m_info);
@@ -673,6 +700,11 @@ bool JPEGImageDecoder::outputScanlines(ImageFrame& buffer)
     JSAMPARRAY samples = m_reader->samples();
     jpeg_decompress_struct* info = m_reader->info();
     int width = isScaled ? m_scaledColumns.size() : info->output_width;
+    // When libjpeg scaled the image down in the DCT domain each output row and
+    // column covers |dctScale| rows and columns of the original image, which is
+    // what the sampling tables index.
+    const int dctScale = isScaled ? info->scale_denom / info->scale_num : 1;
+    const int imageHeight = info->image_height;
 
     while (info->output_scanline < info->output_height) {
         // jpeg_read_scanlines will increase the scanline counter, so we
@@ -682,19 +714,26 @@ bool JPEGImageDecoder::outputScanlines(ImageFrame& buffer)
         if (jpeg_read_scanlines(info, samples, 1) != 1)
             return false;
 
-        int destY = scaledY(sourceY);
-        if (destY < 0)
-            continue;
+#if USE(QCMSLIB)
+        bool colorTransformed = false;
+#endif
+        int originalYEnd = std::min((sourceY + 1) * dctScale, imageHeight);
+        for (int originalY = sourceY * dctScale; originalY < originalYEnd; ++originalY) {
+            int destY = scaledY(originalY);
+            if (destY < 0)
+                continue;
 
 #if USE(QCMSLIB)
-        if (m_reader->colorTransform() && colorSpace == JCS_RGB)
-            qcms_transform_data(m_reader->colorTransform(), *samples, *samples, info->output_width);
+            if (!colorTransformed && m_reader->colorTransform() && colorSpace == JCS_RGB)
+                qcms_transform_data(m_reader->colorTransform(), *samples, *samples, info->output_width);
+            colorTransformed = true;
 #endif
 
-        ImageFrame::PixelData* currentAddress = buffer.getAddr(0, destY);
-        for (int x = 0; x < width; ++x) {
-            setPixel<colorSpace>(buffer, currentAddress, samples, isScaled ? m_scaledColumns[x] : x);
-            ++currentAddress;
+            ImageFrame::PixelData* currentAddress = buffer.getAddr(0, destY);
+            for (int x = 0; x < width; ++x) {
+                setPixel<colorSpace>(buffer, currentAddress, samples, isScaled ? m_scaledColumns[x] / dctScale : x);
+                ++currentAddress;
+            }
         }
     }
     return true;
@@ -26,14 +26,18 @@ see quazip/(un)zip.h files for details. Basically it's the zlib license.
 #include "JlCompress.h"
 #include <QDebug>
 
+// Large chunks keep the number of read() calls and deflate() invocations per
+// file low, which matters when compressing big files.
+static const qint64 COPY_BUFFER_SIZE = 64 * 1024;
+
 static bool copyData(QIODevice &inFile, QIODevice &outFile)
 {
+    QByteArray buf(COPY_BUFFER_SIZE, Qt::Uninitialized);
     while (!inFile.atEnd()) {
-        char buf[4096];
-        qint64 readLen = inFile.read(buf, 4096);
+        qint64 readLen = inFile.read(buf.data(), COPY_BUFFER_SIZE);
         if (readLen <= 0)
             return false;
-        if (outFile.write(buf, readLen) != readLen)
+        if (outFile.write(buf.constData(), readLen) != readLen)
             return false;
     }
     return true;
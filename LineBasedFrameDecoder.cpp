@@ -16,6 +16,8 @@
 
 #include <wangle/codec/LineBasedFrameDecoder.h>
 
+#include <cstring>
+
 namespace wangle {
 
 using folly::io::Cursor;
@@ -92,17 +94,45 @@ void LineBasedFrameDecoder::fail(Context* ctx, std::string len) {
 }
 
 int64_t LineBasedFrameDecoder::findEndOfLine(IOBufQueue& buf) {
-  Cursor c(buf.front());
-  for (uint32_t i = 0; i < maxLength_ && i < buf.chainLength(); i++) {
-    auto b = c.read<char>();
-    if (b == '\n' && terminatorType_ != TerminatorType::CARRIAGENEWLINE) {
-      return i;
-    } else if (
-        terminatorType_ != TerminatorType::NEWLINE && b == '\r' &&
-        !c.isAtEnd() && *c.peekBytes().data() == '\n') {
-      return i;
-    }
+  // Scan each buffer in the chain with memchr for '\n' instead of reading
+  // one byte at a time through a Cursor. Every terminator we accept ends in
+  // '\n', so only the byte in front of a match needs to be inspected (and it
+  // may live at the end of the previous buffer). A "\r\n" whose '\r' is the
+  // last byte within maxLength_ is still accepted, hence the extra byte.
+  const IOBuf* head = buf.front();
+  if (!head) {
+    return -1;
   }
+  const uint64_t limit = uint64_t(maxLength_) + 1;
+  uint64_t offset = 0;
+  char prev = 0;
+  const IOBuf* cur = head;
+  do {
+    auto data = reinterpret_cast<const char*>(cur->data());
+    auto len = size_t(std::min<uint64_t>(cur->length(), limit - offset));
+    auto p = data;
+    auto end = data + len;
+    while (p < end) {
+      auto nl = static_cast<const char*>(memchr(p, '\n', end - p));
+      if (!nl) {
+        break;
+      }
+      uint64_t i = offset + (nl - data);
+      bool crlf = i > 0 && (nl == data ? prev : nl[-1]) == '\r';
+      if (crlf && terminatorType_ != TerminatorType::NEWLINE) {
+        return i - 1;
+      }
+      if (terminatorType_ != TerminatorType::CARRIAGENEWLINE) {
+        return i < maxLength_ ? int64_t(i) : -1;
+      }
+      p = nl + 1;
+    }
+    if (len > 0) {
+      prev = data[len - 1];
+    }
+    offset += len;
+    cur = cur->next();
+  } while (cur != head && offset < limit);
 
   return -1;
 }
@@ -1265,13 +1265,19 @@ bool MDSDaemon::ms_verify_authorizer(Connection *con, int peer_type,
 				     bool& is_valid, CryptoKey& session_key,
 				     std::unique_ptr<AuthAuthorizerChallenge> *challenge)
 {
-  Mutex::Locker l(mds_lock);
-  if (stopping) {
-    return false;
+  {
+    Mutex::Locker l(mds_lock);
+    if (stopping) {
+      return false;
+    }
+    if (beacon.get_want_state() == CEPH_MDS_STATE_DNE)
+      return false;
   }
-  if (beacon.get_want_state() == CEPH_MDS_STATE_DNE)
-    return false;
 
+  // Decrypting and checking the authorizer doesn't touch any MDS state (the
+  // handler registries and rotating keyring have their own locks), so do it
+  // without mds_lock: otherwise every connecting client serializes against
+  // ms_dispatch on the crypto work.
   AuthAuthorizeHandler *authorize_handler = 0;
   switch (peer_type) {
   case CEPH_ENTITY_TYPE_MDS:
@@ -1301,6 +1307,11 @@ bool MDSDaemon::ms_verify_authorizer(Connection *con, int peer_type,
     is_valid = false;
   }
 
+  Mutex::Locker l(mds_lock);
+  if (stopping) {
+    return false;
+  }
+
   if (is_valid) {
     entity_name_t n(con->get_peer_type(), global_id);
 
@@ -4681,18 +4681,20 @@ bool Monitor::_scrub(ScrubResult *r,
     bufferlist bl;
     //TODO: what when store->get returns error or empty bl?
     store->get(k.first, k.second, bl);
-    uint32_t key_crc = bl.crc32c(0);
-    dout(30) << __func__ << " " << k << " bl " << bl.length() << " bytes"
-                                     << " crc " << key_crc << dendl;
+    // the per-key crc is only for debugging; don't checksum every value
+    // twice unless someone is going to read it
+    if (cct->_conf->subsys.should_gather(ceph_subsys_mon, 30)) {
+      dout(30) << __func__ << " " << k << " bl " << bl.length() << " bytes"
+                                       << " crc " << bl.crc32c(0) << dendl;
+    }
     r->prefix_keys[k.first]++;
-    if (r->prefix_crc.count(k.first) == 0)
-      r->prefix_crc[k.first] = 0;
-    r->prefix_crc[k.first] = bl.crc32c(r->prefix_crc[k.first]);
+    uint32_t &prefix_crc = r->prefix_crc[k.first];  // starts at 0
+    prefix_crc = bl.crc32c(prefix_crc);
 
     if (cct->_conf->mon_scrub_inject_crc_mismatch > 0.0 &&
         (rand() % 10000 < cct->_conf->mon_scrub_inject_crc_mismatch*10000.0)) {
       dout(10) << __func__ << " inject failure at (" << k << ")" << dendl;
-      r->prefix_crc[k.first] += 1;
+      prefix_crc += 1;
     }
 
     ++scrubbed_keys;
@@ -175,6 +175,61 @@ bool is_unmanaged_snap_op_permitted(CephContext* cct,
   return false;
 }
 
+enum {
+  l_osdmon_map_cache_first = 45100,
+  l_osdmon_inc_cache_hit,
+  l_osdmon_inc_cache_miss,
+  l_osdmon_full_cache_hit,
+  l_osdmon_full_cache_miss,
+  l_osdmon_map_cache_last,
+};
+
+// hit/miss counters for inc_osd_cache and full_osd_cache, which are shared
+// by every subscriber asking for a given (epoch, significant features) pair;
+// use these to size mon_osd_cache_size.  They are kept here, per OSDMonitor,
+// from on_active() until on_shutdown().
+std::mutex map_cache_loggers_lock;
+std::map<const OSDMonitor*, PerfCounters*> map_cache_loggers;
+
+void create_map_cache_logger(CephContext *cct, const OSDMonitor *osdmon)
+{
+  std::lock_guard<std::mutex> l(map_cache_loggers_lock);
+  if (map_cache_loggers.count(osdmon))
+    return;
+  PerfCountersBuilder pcb(cct, "osdmon_map_cache",
+                          l_osdmon_map_cache_first, l_osdmon_map_cache_last);
+  pcb.add_u64_counter(l_osdmon_inc_cache_hit, "inc_hit",
+                      "Incremental map cache hits");
+  pcb.add_u64_counter(l_osdmon_inc_cache_miss, "inc_miss",
+                      "Incremental map cache misses");
+  pcb.add_u64_counter(l_osdmon_full_cache_hit, "full_hit",
+                      "Full map cache hits");
+  pcb.add_u64_counter(l_osdmon_full_cache_miss, "full_miss",
+                      "Full map cache misses");
+  PerfCounters *logger = pcb.create_perf_counters();
+  cct->get_perfcounters_collection()->add(logger);
+  map_cache_loggers[osdmon] = logger;
+}
+
+void destroy_map_cache_logger(CephContext *cct, const OSDMonitor *osdmon)
+{
+  std::lock_guard<std::mutex> l(map_cache_loggers_lock);
+  auto p = map_cache_loggers.find(osdmon);
+  if (p == map_cache_loggers.end())
+    return;
+  cct->get_perfcounters_collection()->remove(p->second);
+  delete p->second;
+  map_cache_loggers.erase(p);
+}
+
+void inc_map_cache_counter(const OSDMonitor *osdmon, int idx)
+{
+  std::lock_guard<std::mutex> l(map_cache_loggers_lock);
+  auto p = map_cache_loggers.find(osdmon);
+  if (p != map_cache_loggers.end())
+    p->second->inc(idx);
+}
+
 } // anonymous namespace
 
 void LastEpochClean::Lec::report(ps_t ps, epoch_t last_epoch_clean)
@@ -635,6 +690,8 @@ void OSDMonitor::update_msgr_features()
 
 void OSDMonitor::on_active()
 {
+  create_map_cache_logger(cct, this);
+
   update_logger();
 
   if (mon->is_leader()) {
@@ -670,6 +727,8 @@ void OSDMonitor::on_shutdown()
   list<MonOpRequestRef> ls;
   take_all_failures(ls);
   ls.clear();
+
+  destroy_map_cache_logger(cct, this);
 }
 
 void OSDMonitor::update_logger()
@@ -3665,8 +3724,10 @@ int OSDMonitor::get_version(version_t ver, uint64_t features, bufferlist& bl)
 {
   uint64_t significant_features = OSDMap::get_significant_features(features);
   if (inc_osd_cache.lookup({ver, significant_features}, &bl)) {
+    inc_map_cache_counter(this, l_osdmon_inc_cache_hit);
     return 0;
   }
+  inc_map_cache_counter(this, l_osdmon_inc_cache_miss);
   int ret = PaxosService::get_version(ver, bl);
   if (ret < 0) {
     return ret;
@@ -3718,9 +3779,11 @@ int OSDMonitor::get_full_from_pinned_map(version_t ver, bufferlist& bl)
   // get osdmap incremental maps and apply on top of this one.
   bufferlist osdm_bl;
   bool has_cached_osdmap = false;
+  // the cache is keyed on significant features, see get_version_full()
+  uint64_t significant_features =
+    OSDMap::get_significant_features(mon->get_quorum_con_features());
   for (version_t v = ver-1; v >= closest_pinned; --v) {
-    if (full_osd_cache.lookup({v, mon->get_quorum_con_features()},
-                                &osdm_bl)) {
+    if (full_osd_cache.lookup({v, significant_features}, &osdm_bl)) {
       dout(10) << __func__ << " found map in cache ver " << v << dendl;
       closest_pinned = v;
       has_cached_osdmap = true;
@@ -3810,8 +3873,10 @@ int OSDMonitor::get_version_full(version_t ver, uint64_t features,
 {
   uint64_t significant_features = OSDMap::get_significant_features(features);
   if (full_osd_cache.lookup({ver, significant_features}, &bl)) {
+    inc_map_cache_counter(this, l_osdmon_full_cache_hit);
     return 0;
   }
+  inc_map_cache_counter(this, l_osdmon_full_cache_miss);
   int ret = PaxosService::get_version_full(ver, bl);
   if (ret == -ENOENT) {
     // build map?
@@ -254,16 +254,22 @@ void PageSerializer::serializeFrame(Frame* frame)
 
 void PageSerializer::serializeCSSStyleSheet(CSSStyleSheet* styleSheet, const KURL& url)
 {
+    // Inline <style> sheets and sheets that were already saved are only walked
+    // for the resources they reference, so don't pay for serializing their rules.
+    bool shouldSerializeText = url.isValid() && !m_resourceURLs.contains(url);
+    Document* document = styleSheet->ownerDocument();
     StringBuilder cssText;
-    for (unsigned i = 0; i < styleSheet->length(); ++i) {
+    unsigned ruleCount = styleSheet->length();
+    for (unsigned i = 0; i < ruleCount; ++i) {
         CSSRule* rule = styleSheet->item(i);
-        String itemText = rule->cssText();
-        if (!itemText.isEmpty()) {
-            cssText.append(itemText);
-            if (i < styleSheet->length() - 1)
-                cssText.append("\n\n");
+        if (shouldSerializeText) {
+            String itemText = rule->cssText();
+            if (!itemText.isEmpty()) {
+                cssText.append(itemText);
+                if (i < ruleCount - 1)
+                    cssText.append("\n\n");
+            }
         }
-        Document* document = styleSheet->ownerDocument();
         // Some rules have resources associated with them that we need to retrieve.
         if (rule->type() == CSSRule::IMPORT_RULE) {
             CSSImportRule* importRule = toCSSImportRule(rule);
@@ -278,7 +284,7 @@ void PageSerializer::serializeCSSStyleSheet(CSSStyleSheet* styleSheet, const KUR
         }
     }
 
-    if (url.isValid() && !m_resourceURLs.contains(url)) {
+    if (shouldSerializeText && !m_resourceURLs.contains(url)) {
         // FIXME: We should check whether a charset has been specified and if none was found add one.
         WTF::TextEncoding textEncoding(styleSheet->contents()->charset());
         ASSERT(textEncoding.isValid());
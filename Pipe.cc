@@ -1791,7 +1791,11 @@ void Pipe::reader()
       // note last received message.
       in_seq = m->get_seq();
 
-      cond.Signal();  // wake up writer, to ack this
+      // wake up writer, to ack this.  if the rest of a burst is already
+      // sitting in the prefetch buffer, leave it to the last message of the
+      // burst so the writer wakes (and acks) once instead of per message.
+      if (!has_pending_data())
+	cond.Signal();
       
       ldout(msgr->cct,10) << "reader got message "
 	       << m->get_seq() << " " << m << " " << *m
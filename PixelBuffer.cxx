@@ -31,6 +31,53 @@ using namespace rdr;
 
 static LogWriter vlog("PixelBuffer");
 
+// Per pixel size kernels. Keeping the pixel type fixed inside the loops
+// lets the compiler use wide stores instead of a memcpy or a switch for
+// every pixel.
+
+template<class T>
+static inline void fillRow(T* dst, T pix, int w)
+{
+  while (w--)
+    *dst++ = pix;
+}
+
+template<class T>
+static void maskRectImage(U8* data, int stride, const T* pixels,
+                          int pixelStride, const U8* mask, int maskStride,
+                          const Point& offset, int w, int h)
+{
+  T* dst = (T*)data;
+  const T* src = pixels + offset.y * pixelStride;
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      int cx = offset.x + x;
+      if (mask[cx / 8] & (1 << (7 - cx % 8)))
+        dst[x] = src[cx];
+    }
+    dst += stride;
+    src += pixelStride;
+    mask += maskStride;
+  }
+}
+
+template<class T>
+static void maskRectPixel(U8* data, int stride, T pixel,
+                          const U8* mask, int maskStride,
+                          const Point& offset, int w, int h)
+{
+  T* dst = (T*)data;
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      int cx = offset.x + x;
+      if (mask[cx / 8] & (1 << (7 - cx % 8)))
+        dst[x] = pixel;
+    }
+    dst += stride;
+    mask += maskStride;
+  }
+}
+
 
 // -=- Generic pixel buffer class
 
@@ -133,12 +180,23 @@ void ModifiablePixelBuffer::fillRect(const Rect& r, const void* pix)
 
     start = buf;
 
-    w1 = w;
-    while (w1--) {
-      memcpy(buf, pix, b);
-      buf += b;
+    if (b == 2) {
+      U16 pix16;
+      memcpy(&pix16, pix, sizeof(pix16));
+      fillRow((U16*)buf, pix16, w);
+    } else if (b == 4) {
+      U32 pix32;
+      memcpy(&pix32, pix, sizeof(pix32));
+      fillRow((U32*)buf, pix32, w);
+    } else {
+      w1 = w;
+      while (w1--) {
+        memcpy(buf, pix, b);
+        buf += b;
+      }
+      buf = start;
     }
-    buf += (stride - w) * b;
+    buf += stride * b;
     h--;
 
     while (h--) {
@@ -186,27 +244,19 @@ void ModifiablePixelBuffer::maskRect(const Rect& r,
 
   Point offset = Point(cr.tl.x-r.tl.x, cr.tl.y-r.tl.y);
   mask += offset.y * maskStride;
-  for (int y = 0; y < h; y++) {
-    int cy = offset.y + y;
-    for (int x = 0; x < w; x++) {
-      int cx = offset.x + x;
-      U8* byte = mask + (cx / 8);
-      int bit = 7 - cx % 8;
-      if ((*byte) & (1 << bit)) {
-        switch (bpp) {
-        case 8:
-          ((U8*)data)[y * stride + x] = ((U8*)pixels)[cy * pixelStride + cx];
-          break;
-        case 16:
-          ((U16*)data)[y * stride + x] = ((U16*)pixels)[cy * pixelStride + cx];
-          break;
-        case 32:
-          ((U32*)data)[y * stride + x] = ((U32*)pixels)[cy * pixelStride + cx];
-          break;
-        }
-      }
-    }
-    mask += maskStride;
+  switch (bpp) {
+  case 8:
+    maskRectImage(data, stride, (const U8*)pixels, pixelStride,
+                  mask, maskStride, offset, w, h);
+    break;
+  case 16:
+    maskRectImage(data, stride, (const U16*)pixels, pixelStride,
+                  mask, maskStride, offset, w, h);
+    break;
+  case 32:
+    maskRectImage(data, stride, (const U32*)pixels, pixelStride,
+                  mask, maskStride, offset, w, h);
+    break;
   }
 
   commitBufferRW(cr);
@@ -227,26 +277,16 @@ void ModifiablePixelBuffer::maskRect(const Rect& r,
 
   Point offset = Point(cr.tl.x-r.tl.x, cr.tl.y-r.tl.y);
   mask += offset.y * maskStride;
-  for (int y = 0; y < h; y++) {
-    for (int x = 0; x < w; x++) {
-      int cx = offset.x + x;
-      U8* byte = mask + (cx / 8);
-      int bit = 7 - cx % 8;
-      if ((*byte) & (1 << bit)) {
-        switch (bpp) {
-        case 8:
-          ((U8*)data)[y * stride + x] = pixel;
-          break;
-        case 16:
-          ((U16*)data)[y * stride + x] = pixel;
-          break;
-        case 32:
-          ((U32*)data)[y * stride + x] = pixel;
-          break;
-        }
-      }
-    }
-    mask += maskStride;
+  switch (bpp) {
+  case 8:
+    maskRectPixel(data, stride, (U8)pixel, mask, maskStride, offset, w, h);
+    break;
+  case 16:
+    maskRectPixel(data, stride, (U16)pixel, mask, maskStride, offset, w, h);
+    break;
+  case 32:
+    maskRectPixel(data, stride, (U32)pixel, mask, maskStride, offset, w, h);
+    break;
   }
 
   commitBufferRW(cr);
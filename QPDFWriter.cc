@@ -1687,94 +1687,87 @@ QPDFWriter::writeObjectStream(QPDFObjectHandle object)
     qpdf_offset_t first = 0;
 
     // Generate stream itself.  We have to do this in two passes so we
-    // can calculate offsets in the first pass.
+    // can calculate offsets in the first pass.  The objects are only
+    // unparsed once: the first pass keeps their text so that the
+    // second pass just has to prepend the offset table to it.
     PointerHolder<Buffer> stream_buffer;
+    PointerHolder<Buffer> objects_buffer;
     int first_obj = -1;
     bool compressed = false;
-    for (int pass = 1; pass <= 2; ++pass)
+
+    pushPipeline(new Pl_Buffer("object stream objects"));
+    activatePipelineStack();
+    std::set<QPDFObjGen> const& objects =
+        this->object_stream_to_objects[old_id];
+    int count = 0;
+    for (std::set<QPDFObjGen>::const_iterator iter = objects.begin();
+         iter != objects.end(); ++iter, ++count)
     {
-	if (pass == 1)
+	QPDFObjGen obj = *iter;
+	int new_obj = this->obj_renumber[obj];
+	if (first_obj == -1)
 	{
-	    pushDiscardFilter();
+	    first_obj = new_obj;
 	}
-	else
+	if (this->qdf_mode)
 	{
-	    // Adjust offsets to skip over comment before first object
-
-	    first = offsets.at(0);
-	    for (std::vector<qpdf_offset_t>::iterator iter = offsets.begin();
-		 iter != offsets.end(); ++iter)
+	    writeString("%% Object stream: object " +
+			QUtil::int_to_string(new_obj) + ", index " +
+			QUtil::int_to_string(count));
+	    if (! this->suppress_original_object_ids)
 	    {
-		*iter -= first;
+		writeString("; original object ID: " +
+			    QUtil::int_to_string(obj.getObj()));
+                // For compatibility, only write the generation if
+                // non-zero.  While object streams only allow
+                // objects with generation 0, if we are generating
+                // object streams, the old object could have a
+                // non-zero generation.
+                if (obj.getGen() != 0)
+                {
+                    QTC::TC("qpdf", "QPDFWriter original obj non-zero gen");
+                    writeString(" " + QUtil::int_to_string(obj.getGen()));
+                }
 	    }
+	    writeString("\n");
+	}
+	offsets.push_back(this->pipeline->getCount());
+	writeObject(this->pdf.getObjectByObjGen(obj), count);
 
-	    // Take one pass at writing pairs of numbers so we can get
-	    // their size information
-	    pushDiscardFilter();
-	    writeObjectStreamOffsets(offsets, first_obj);
-	    first += this->pipeline->getCount();
-	    popPipelineStack();
+	this->xref[new_obj] = QPDFXRefEntry(2, new_id, count);
+    }
+    popPipelineStack(&objects_buffer);
 
-	    // Set up a stream to write the stream data into a buffer.
-	    Pipeline* next = pushPipeline(new Pl_Buffer("object stream"));
-	    if (! ((this->stream_data_mode == qpdf_s_uncompress) ||
-		   this->qdf_mode))
-	    {
-		compressed = true;
-		next = pushPipeline(
-		    new Pl_Flate("compress object stream", next,
-				 Pl_Flate::a_deflate));
-	    }
-	    activatePipelineStack();
-	    writeObjectStreamOffsets(offsets, first_obj);
-	}
+    // Adjust offsets to skip over comment before first object
 
-	int count = 0;
-	for (std::set<QPDFObjGen>::iterator iter =
-		 this->object_stream_to_objects[old_id].begin();
-	     iter != this->object_stream_to_objects[old_id].end();
-	     ++iter, ++count)
-	{
-	    QPDFObjGen obj = *iter;
-	    int new_obj = this->obj_renumber[obj];
-	    if (first_obj == -1)
-	    {
-		first_obj = new_obj;
-	    }
-	    if (this->qdf_mode)
-	    {
-		writeString("%% Object stream: object " +
-			    QUtil::int_to_string(new_obj) + ", index " +
-			    QUtil::int_to_string(count));
-		if (! this->suppress_original_object_ids)
-		{
-		    writeString("; original object ID: " +
-				QUtil::int_to_string(obj.getObj()));
-                    // For compatibility, only write the generation if
-                    // non-zero.  While object streams only allow
-                    // objects with generation 0, if we are generating
-                    // object streams, the old object could have a
-                    // non-zero generation.
-                    if (obj.getGen() != 0)
-                    {
-                        QTC::TC("qpdf", "QPDFWriter original obj non-zero gen");
-                        writeString(" " + QUtil::int_to_string(obj.getGen()));
-                    }
-		}
-		writeString("\n");
-	    }
-	    if (pass == 1)
-	    {
-		offsets.push_back(this->pipeline->getCount());
-	    }
-	    writeObject(this->pdf.getObjectByObjGen(obj), count);
+    first = offsets.at(0);
+    for (std::vector<qpdf_offset_t>::iterator iter = offsets.begin();
+	 iter != offsets.end(); ++iter)
+    {
+	*iter -= first;
+    }
 
-	    this->xref[new_obj] = QPDFXRefEntry(2, new_id, count);
-	}
+    // Take one pass at writing pairs of numbers so we can get
+    // their size information
+    pushDiscardFilter();
+    writeObjectStreamOffsets(offsets, first_obj);
+    first += this->pipeline->getCount();
+    popPipelineStack();
 
-	// stream_buffer will be initialized only for pass 2
-	popPipelineStack(&stream_buffer);
+    // Set up a stream to write the stream data into a buffer.
+    Pipeline* next = pushPipeline(new Pl_Buffer("object stream"));
+    if (! ((this->stream_data_mode == qpdf_s_uncompress) ||
+	   this->qdf_mode))
+    {
+	compressed = true;
+	next = pushPipeline(
+	    new Pl_Flate("compress object stream", next,
+			 Pl_Flate::a_deflate));
     }
+    activatePipelineStack();
+    writeObjectStreamOffsets(offsets, first_obj);
+    writeBuffer(objects_buffer);
+    popPipelineStack(&stream_buffer);
 
     // Write the object
     openObject(new_id);
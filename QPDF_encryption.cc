@@ -279,6 +279,10 @@ hash_V5(std::string const& password,
 
         int round_number = 0;
         bool done = false;
+        // These are rebuilt on every round; keeping them outside the
+        // loop lets their storage be reused instead of reallocated.
+        std::string K1;
+        std::string aes_key;
         while (! done)
         {
             // The hash algorithm has us setting K initially to the R5
@@ -299,11 +303,14 @@ hash_V5(std::string const& password,
             // conditions under which we terminated repetition.
 
             ++round_number;
-            std::string K1 = password + K + udata;
+            K1.assign(password);
+            K1.append(K);
+            K1.append(udata);
             assert(K.length() >= 32);
+            aes_key.assign(K, 0, 16);
             std::string E = process_with_aes(
-                K.substr(0, 16), true, K1, 0, 64,
-                QUtil::unsigned_char_pointer(K.substr(16, 16)), 16);
+                aes_key, true, K1, 0, 64,
+                QUtil::unsigned_char_pointer(K) + 16, 16);
 
             // E_mod_3 is supposed to be mod 3 of the first 16 bytes
             // of E taken as as a (128-bit) big-endian number.  Since
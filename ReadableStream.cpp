@@ -84,8 +84,11 @@ void ReadableStream::close()
 void ReadableStream::readInternalPostAction()
 {
     ASSERT(m_state == Readable);
-    if (isQueueEmpty() && m_isDraining)
+    if (isQueueEmpty() && m_isDraining) {
+        // A closed stream never pulls again.
         closeInternal();
+        return;
+    }
     callPullIfNeeded();
 }
 
@@ -1215,15 +1215,17 @@ void ResourceFetcher::requestPreload(Resource::Type type, FetchRequest& request,
 
 bool ResourceFetcher::isPreloaded(const String& urlString) const
 {
+    // Most documents never preload anything; don't pay for resolving the URL.
+    if (!m_preloads || m_preloads->isEmpty())
+        return false;
+
     const KURL& url = m_document->completeURL(urlString);
 
-    if (m_preloads) {
-        ListHashSet<Resource*>::iterator end = m_preloads->end();
-        for (ListHashSet<Resource*>::iterator it = m_preloads->begin(); it != end; ++it) {
-            Resource* resource = *it;
-            if (resource->url() == url)
-                return true;
-        }
+    ListHashSet<Resource*>::iterator end = m_preloads->end();
+    for (ListHashSet<Resource*>::iterator it = m_preloads->begin(); it != end; ++it) {
+        Resource* resource = *it;
+        if (resource->url() == url)
+            return true;
     }
 
     return false;
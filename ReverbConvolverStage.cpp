@@ -36,6 +36,7 @@
 #include "core/platform/audio/ReverbConvolver.h"
 #include "core/platform/audio/ReverbInputBuffer.h"
 #include "core/platform/audio/VectorMath.h"
+#include "core/platform/chromium/TraceEvent.h"
 #include "wtf/OwnPtr.h"
 #include "wtf/PassOwnPtr.h"
 
@@ -96,6 +97,10 @@ ReverbConvolverStage::ReverbConvolverStage(const float* impulseResponse, size_t,
 
 void ReverbConvolverStage::processInBackground(ReverbConvolver* convolver, size_t framesToProcess)
 {
+    // The background thread runs every tail stage in turn; tracing each stage
+    // shows which ones eat into the time before the realtime thread needs the
+    // accumulated output.
+    TRACE_EVENT2("webaudio", "ReverbConvolverStage::processInBackground", "framesToProcess", framesToProcess, "postDelayLength", m_postDelayLength);
     ReverbInputBuffer* inputBuffer = convolver->inputBuffer();
     float* source = inputBuffer->directReadFrom(&m_inputReadIndex, framesToProcess);
     process(source, framesToProcess);
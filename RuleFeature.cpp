@@ -598,61 +598,79 @@ void RuleFeatureSet::clear()
 
 void RuleFeatureSet::collectInvalidationSetsForClass(InvalidationLists& invalidationLists, Element& element, const AtomicString& className) const
 {
-    if (RefPtrWillBeRawPtr<InvalidationData> invalidationData = m_classInvalidationSets.get(className)) {
-        if (invalidationData->descendants()) {
-            TRACE_SCHEDULE_STYLE_INVALIDATION(element, *invalidationData->descendants(), classChange, className);
-            invalidationLists.descendants.append(invalidationData->descendants());
-        }
-        if (invalidationData->siblings()) {
-            if (element.parentElement())
-                TRACE_SCHEDULE_STYLE_INVALIDATION(*element.parentElement(), *invalidationData->siblings(), classChange, className);
-            invalidationLists.siblings.append(invalidationData->siblings());
-        }
+    // Most mutations touch names that no rule mentions; bail out before
+    // taking a reference on the invalidation data.
+    if (m_classInvalidationSets.isEmpty())
+        return;
+    auto it = m_classInvalidationSets.find(className);
+    if (it == m_classInvalidationSets.end())
+        return;
+    InvalidationData* invalidationData = it->value.get();
+    if (invalidationData->descendants()) {
+        TRACE_SCHEDULE_STYLE_INVALIDATION(element, *invalidationData->descendants(), classChange, className);
+        invalidationLists.descendants.append(invalidationData->descendants());
+    }
+    if (invalidationData->siblings()) {
+        if (element.parentElement())
+            TRACE_SCHEDULE_STYLE_INVALIDATION(*element.parentElement(), *invalidationData->siblings(), classChange, className);
+        invalidationLists.siblings.append(invalidationData->siblings());
     }
 }
 
 void RuleFeatureSet::collectInvalidationSetsForId(InvalidationLists& invalidationLists, Element& element, const AtomicString& id) const
 {
-    if (RefPtrWillBeRawPtr<InvalidationData> invalidationData = m_idInvalidationSets.get(id)) {
-        if (invalidationData->descendants()) {
-            TRACE_SCHEDULE_STYLE_INVALIDATION(element, *invalidationData->descendants(), idChange, id);
-            invalidationLists.descendants.append(invalidationData->descendants());
-        }
-        if (invalidationData->siblings()) {
-            if (element.parentElement())
-                TRACE_SCHEDULE_STYLE_INVALIDATION(*element.parentElement(), *invalidationData->siblings(), idChange, id);
-            invalidationLists.siblings.append(invalidationData->siblings());
-        }
+    if (m_idInvalidationSets.isEmpty())
+        return;
+    auto it = m_idInvalidationSets.find(id);
+    if (it == m_idInvalidationSets.end())
+        return;
+    InvalidationData* invalidationData = it->value.get();
+    if (invalidationData->descendants()) {
+        TRACE_SCHEDULE_STYLE_INVALIDATION(element, *invalidationData->descendants(), idChange, id);
+        invalidationLists.descendants.append(invalidationData->descendants());
+    }
+    if (invalidationData->siblings()) {
+        if (element.parentElement())
+            TRACE_SCHEDULE_STYLE_INVALIDATION(*element.parentElement(), *invalidationData->siblings(), idChange, id);
+        invalidationLists.siblings.append(invalidationData->siblings());
     }
 }
 
 void RuleFeatureSet::collectInvalidationSetsForAttribute(InvalidationLists& invalidationLists, Element& element, const QualifiedName& attributeName) const
 {
-    if (RefPtrWillBeRawPtr<InvalidationData> invalidationData = m_attributeInvalidationSets.get(attributeName.localName())) {
-        if (invalidationData->descendants()) {
-            TRACE_SCHEDULE_STYLE_INVALIDATION(element, *invalidationData->descendants(), attributeChange, attributeName);
-            invalidationLists.descendants.append(invalidationData->descendants());
-        }
-        if (invalidationData->siblings()) {
-            if (element.parentElement())
-                TRACE_SCHEDULE_STYLE_INVALIDATION(*element.parentElement(), *invalidationData->siblings(), attributeChange, attributeName);
-            invalidationLists.siblings.append(invalidationData->siblings());
-        }
+    if (m_attributeInvalidationSets.isEmpty())
+        return;
+    auto it = m_attributeInvalidationSets.find(attributeName.localName());
+    if (it == m_attributeInvalidationSets.end())
+        return;
+    InvalidationData* invalidationData = it->value.get();
+    if (invalidationData->descendants()) {
+        TRACE_SCHEDULE_STYLE_INVALIDATION(element, *invalidationData->descendants(), attributeChange, attributeName);
+        invalidationLists.descendants.append(invalidationData->descendants());
+    }
+    if (invalidationData->siblings()) {
+        if (element.parentElement())
+            TRACE_SCHEDULE_STYLE_INVALIDATION(*element.parentElement(), *invalidationData->siblings(), attributeChange, attributeName);
+        invalidationLists.siblings.append(invalidationData->siblings());
     }
 }
 
 void RuleFeatureSet::collectInvalidationSetsForPseudoClass(InvalidationLists& invalidationLists, Element& element, CSSSelector::PseudoType pseudo) const
 {
-    if (RefPtrWillBeRawPtr<InvalidationData> invalidationData = m_pseudoInvalidationSets.get(pseudo)) {
-        if (invalidationData->descendants()) {
-            TRACE_SCHEDULE_STYLE_INVALIDATION(element, *invalidationData->descendants(), pseudoChange, pseudo);
-            invalidationLists.descendants.append(invalidationData->descendants());
-        }
-        if (invalidationData->siblings()) {
-            if (element.parentElement())
-                TRACE_SCHEDULE_STYLE_INVALIDATION(*element.parentElement(), *invalidationData->siblings(), pseudoChange, pseudo);
-            invalidationLists.siblings.append(invalidationData->siblings());
-        }
+    if (m_pseudoInvalidationSets.isEmpty())
+        return;
+    auto it = m_pseudoInvalidationSets.find(pseudo);
+    if (it == m_pseudoInvalidationSets.end())
+        return;
+    InvalidationData* invalidationData = it->value.get();
+    if (invalidationData->descendants()) {
+        TRACE_SCHEDULE_STYLE_INVALIDATION(element, *invalidationData->descendants(), pseudoChange, pseudo);
+        invalidationLists.descendants.append(invalidationData->descendants());
+    }
+    if (invalidationData->siblings()) {
+        if (element.parentElement())
+            TRACE_SCHEDULE_STYLE_INVALIDATION(*element.parentElement(), *invalidationData->siblings(), pseudoChange, pseudo);
+        invalidationLists.siblings.append(invalidationData->siblings());
     }
 }
 
@@ -301,7 +301,11 @@ void SMILTimeContainer::updateDocumentOrderIndexes()
 
 struct PriorityCompare {
     PriorityCompare(SMILTime elapsed) : m_elapsed(elapsed) {}
-    bool operator()(const RefPtr<SVGSMILElement>& a, const RefPtr<SVGSMILElement>& b)
+    bool operator()(const RefPtr<SVGSMILElement>& a, const RefPtr<SVGSMILElement>& b) const
+    {
+        return (*this)(a.get(), b.get());
+    }
+    bool operator()(SVGSMILElement* a, SVGSMILElement* b) const
     {
         // FIXME: This should also consider possible timing relations between the elements.
         SMILTime aBegin = a->intervalBegin();
@@ -316,6 +320,20 @@ struct PriorityCompare {
     SMILTime m_elapsed;
 };
 
+// The priority order of a group rarely changes between ticks, so checking it
+// first avoids re-sorting every group of a long running animation each frame.
+template<typename Container>
+static void sortByPriority(Container& animations, SMILTime elapsed)
+{
+    PriorityCompare compare(elapsed);
+    for (size_t i = 1; i < animations.size(); ++i) {
+        if (compare(animations[i], animations[i - 1])) {
+            std::sort(animations.begin(), animations.end(), compare);
+            return;
+        }
+    }
+}
+
 Document& SMILTimeContainer::document() const
 {
     return m_ownerSVGElement.document();
@@ -385,7 +403,7 @@ SMILTime SMILTimeContainer::updateAnimations(SMILTime elapsed, bool seekToTime)
         // In case of a tie, document order decides.
         // FIXME: This should also consider timing relationships between the elements. Dependents
         // have higher priority.
-        std::sort(scheduled->begin(), scheduled->end(), PriorityCompare(elapsed));
+        sortByPriority(*scheduled, elapsed);
 
         SVGSMILElement* resultElement = 0;
         unsigned size = scheduled->size();
@@ -416,7 +434,7 @@ SMILTime SMILTimeContainer::updateAnimations(SMILTime elapsed, bool seekToTime)
             animationsToApply.append(resultElement);
     }
 
-    std::sort(animationsToApply.begin(), animationsToApply.end(), PriorityCompare(elapsed));
+    sortByPriority(animationsToApply, elapsed);
 
     unsigned animationsToApplySize = animationsToApply.size();
     if (!animationsToApplySize) {
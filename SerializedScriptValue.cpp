@@ -2822,7 +2822,12 @@ PassRefPtr<SerializedScriptValue> SerializedScriptValue::createFromWireBytes(con
     for (size_t i = 0; i < length; i++)
         dst[i] = ntohs(src[i]);
 
-    return createFromWire(String::adopt(buffer));
+    // The decoded string is not shared with anyone, so unlike createFromWire()
+    // it can be adopted without another isolated copy.
+    RefPtr<SerializedScriptValue> value = create();
+    value->m_data = String::adopt(buffer);
+    ASSERT(value->m_data.isEmpty() || value->m_data.impl()->hasOneRef());
+    return value.release();
 }
 
 PassRefPtr<SerializedScriptValue> SerializedScriptValue::create(const String& data)
@@ -2834,8 +2839,10 @@ PassRefPtr<SerializedScriptValue> SerializedScriptValue::create(const String& da
 {
     Writer writer;
     writer.writeWebCoreString(data);
-    String wireData = writer.takeWireString();
-    return adoptRef(new SerializedScriptValue(wireData));
+    RefPtr<SerializedScriptValue> value = create();
+    value->m_data = writer.takeWireString();
+    ASSERT(value->m_data.impl()->hasOneRef());
+    return value.release();
 }
 
 PassRefPtr<SerializedScriptValue> SerializedScriptValue::create()
@@ -2847,8 +2854,10 @@ PassRefPtr<SerializedScriptValue> SerializedScriptValue::nullValue()
 {
     Writer writer;
     writer.writeNull();
-    String wireData = writer.takeWireString();
-    return adoptRef(new SerializedScriptValue(wireData));
+    RefPtr<SerializedScriptValue> value = create();
+    value->m_data = writer.takeWireString();
+    ASSERT(value->m_data.impl()->hasOneRef());
+    return value.release();
 }
 
 // Convert serialized string to big endian wire data.
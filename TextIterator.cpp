@@ -1646,10 +1646,14 @@ static inline void foldQuoteMarksAndSoftHyphens(String& s)
 
 #if !UCONFIG_NO_COLLATION
 
-static inline void foldQuoteMarksAndSoftHyphens(UChar* data, size_t length)
+static inline void foldQuoteMarksAndSoftHyphens(const UChar* source, UChar* destination, size_t length)
 {
-    for (size_t i = 0; i < length; ++i)
-        data[i] = foldQuoteMarkOrSoftHyphen(data[i]);
+    for (size_t i = 0; i < length; ++i) {
+        UChar c = source[i];
+        // All folded characters are at or above the soft hyphen, so the common
+        // ASCII case skips the switch.
+        destination[i] = c < softHyphen ? c : foldQuoteMarkOrSoftHyphen(c);
+    }
 }
 
 static const size_t minimumSearchBufferSize = 8192;
@@ -2008,8 +2012,10 @@ inline size_t SearchBuffer::append(const UChar* characters, size_t length)
     size_t oldLength = m_buffer.size();
     size_t usableLength = min(m_buffer.capacity() - oldLength, length);
     ASSERT(usableLength);
-    m_buffer.append(characters, usableLength);
-    foldQuoteMarksAndSoftHyphens(m_buffer.data() + oldLength, usableLength);
+    // Fold while copying so that every appended character is touched once rather
+    // than once by the append and again by an in-place folding pass.
+    m_buffer.grow(oldLength + usableLength);
+    foldQuoteMarksAndSoftHyphens(characters, m_buffer.data() + oldLength, usableLength);
     return usableLength;
 }
 
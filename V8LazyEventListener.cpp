@@ -39,6 +39,7 @@
 #include "bindings/core/v8/V8HTMLFormElement.h"
 #include "bindings/core/v8/V8HiddenValue.h"
 #include "bindings/core/v8/V8Node.h"
+#include "bindings/core/v8/V8PerIsolateData.h"
 #include "bindings/core/v8/V8ScriptRunner.h"
 #include "core/dom/Document.h"
 #include "core/dom/Node.h"
@@ -104,6 +105,21 @@ static void V8LazyEventListenerToString(const v8::FunctionCallbackInfo<v8::Value
     v8SetReturnValue(info, V8HiddenValue::getHiddenValue(info.GetIsolate(), info.Holder(), V8HiddenValue::toStringString(info.GetIsolate())));
 }
 
+// The toString function only reads the hidden source string off its holder, so
+// every lazy listener in a context can share one instance instead of creating
+// a new function per element.
+static v8::Local<v8::Function> lazyEventListenerToStringFunction(v8::Isolate* isolate)
+{
+    static int toStringTemplateKey; // This address is used for a key to look up the dom template.
+    V8PerIsolateData* data = V8PerIsolateData::from(isolate);
+    v8::Local<v8::FunctionTemplate> toStringTemplate = data->existingDOMTemplate(&toStringTemplateKey);
+    if (toStringTemplate.IsEmpty()) {
+        toStringTemplate = v8::FunctionTemplate::New(isolate, V8LazyEventListenerToString);
+        data->setDOMTemplate(&toStringTemplateKey, toStringTemplate);
+    }
+    return toStringTemplate->GetFunction();
+}
+
 void V8LazyEventListener::prepareListenerObject(ExecutionContext* executionContext)
 {
     if (!executionContext)
@@ -204,7 +220,7 @@ void V8LazyEventListener::prepareListenerObject(ExecutionContext* executionConte
     // source returned (sometimes a RegExp is applied as well) for some
     // other use. That fails miserably if the actual wrapper source is
     // returned.
-    v8::Local<v8::Function> toStringFunction = v8::Function::New(isolate(), V8LazyEventListenerToString);
+    v8::Local<v8::Function> toStringFunction = lazyEventListenerToStringFunction(isolate());
     ASSERT(!toStringFunction.IsEmpty());
     String toStringString = "function " + m_functionName + "(" + m_eventParameterName + ") {\n  " + m_code + "\n}";
     V8HiddenValue::setHiddenValue(isolate(), wrappedFunction, V8HiddenValue::toStringString(isolate()), v8String(isolate(), toStringString));
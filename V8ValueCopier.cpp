@@ -20,7 +20,7 @@ public:
 
         if (value.IsEmpty())
             return v8::MaybeLocal<v8::Value>();
-        if (value->IsNull() || value->IsUndefined() || value->IsBoolean() || value->IsString() || value->IsNumber())
+        if (isPrimitive(value))
             return value;
         if (!value->IsObject())
             return v8::MaybeLocal<v8::Value>();
@@ -30,17 +30,18 @@ public:
 
         if (object->IsArray()) {
             v8::Local<v8::Array> array = object.As<v8::Array>();
-            v8::Local<v8::Array> result = v8::Array::New(m_isolate, array->Length());
+            uint32_t length = array->Length();
+            v8::Local<v8::Array> result = v8::Array::New(m_isolate, length);
             if (!result->SetPrototype(m_to, v8::Null(m_isolate)).FromMaybe(false))
                 return v8::MaybeLocal<v8::Value>();
-            for (size_t i = 0; i < array->Length(); ++i) {
+            for (uint32_t i = 0; i < length; ++i) {
                 v8::Local<v8::Value> item;
                 if (!array->Get(m_from, i).ToLocal(&item))
                     return v8::MaybeLocal<v8::Value>();
                 v8::Local<v8::Value> copied;
-                if (!copy(item, depth + 1).ToLocal(&copied))
+                if (!copyItem(item, depth + 1).ToLocal(&copied))
                     return v8::MaybeLocal<v8::Value>();
-                if (!result->Set(m_to, i, copied).FromMaybe(false))
+                if (!result->CreateDataProperty(m_to, i, copied).FromMaybe(false))
                     return v8::MaybeLocal<v8::Value>();
             }
             return result;
@@ -53,7 +54,8 @@ public:
         v8::Local<v8::Array> properties;
         if (!object->GetOwnPropertyNames(m_from).ToLocal(&properties))
             return v8::MaybeLocal<v8::Value>();
-        for (size_t i = 0; i < properties->Length(); ++i) {
+        uint32_t propertyCount = properties->Length();
+        for (uint32_t i = 0; i < propertyCount; ++i) {
             v8::Local<v8::Value> name;
             if (!properties->Get(m_from, i).ToLocal(&name) || !name->IsString())
                 return v8::MaybeLocal<v8::Value>();
@@ -61,14 +63,31 @@ public:
             if (!object->Get(m_from, name).ToLocal(&property))
                 return v8::MaybeLocal<v8::Value>();
             v8::Local<v8::Value> copied;
-            if (!copy(property, depth + 1).ToLocal(&copied))
+            if (!copyItem(property, depth + 1).ToLocal(&copied))
                 return v8::MaybeLocal<v8::Value>();
-            if (!result->Set(m_to, name, copied).FromMaybe(false))
+            if (!result->CreateDataProperty(m_to, name.As<v8::String>(), copied).FromMaybe(false))
                 return v8::MaybeLocal<v8::Value>();
         }
         return result;
     }
 
+    // Primitive array items and property values are returned as is, so they
+    // skip the recursive call. They still count towards kMaxCalls and
+    // kMaxDepth.
+    v8::MaybeLocal<v8::Value> copyItem(v8::Local<v8::Value> value, int depth)
+    {
+        if (!isPrimitive(value))
+            return copy(value, depth);
+        if (++m_calls > kMaxCalls || depth > kMaxDepth)
+            return v8::MaybeLocal<v8::Value>();
+        return value;
+    }
+
+    static bool isPrimitive(v8::Local<v8::Value> value)
+    {
+        return value->IsNull() || value->IsUndefined() || value->IsBoolean() || value->IsString() || value->IsNumber();
+    }
+
     v8::Isolate* m_isolate;
     v8::Local<v8::Context> m_from;
     v8::Local<v8::Context> m_to;
@@ -526,7 +526,7 @@ namespace XrdCl
   //----------------------------------------------------------------------------
   Monitor *DefaultEnv::GetMonitor()
   {
-    if( unlikely( !sMonitorInitialized ) )
+    if( unlikely( !__atomic_load_n( &sMonitorInitialized, __ATOMIC_ACQUIRE ) ) )
     {
       XrdSysMutexHelper scopedLock( sInitMutex );
       if( !sMonitorInitialized )
@@ -536,13 +536,13 @@ namespace XrdCl
         //----------------------------------------------------------------------
         Env *env = GetEnv();
         Log *log = GetLog();
-        sMonitorInitialized = true;
         std::string monitorLib = DefaultClientMonitor;
         env->GetString( "ClientMonitor", monitorLib );
         if( monitorLib.empty() )
         {
           log->Debug( UtilityMsg, "Monitor library name not set. No "
                       "monitoring" );
+          __atomic_store_n( &sMonitorInitialized, true, __ATOMIC_RELEASE );
           return 0;
         }
 
@@ -570,6 +570,7 @@ namespace XrdCl
           delete [] errBuffer;
           sMonitorLibHandle->Unload();
           delete sMonitorLibHandle; sMonitorLibHandle = 0;
+          __atomic_store_n( &sMonitorInitialized, true, __ATOMIC_RELEASE );
           return 0;
         }
 
@@ -586,11 +587,19 @@ namespace XrdCl
           delete [] errBuffer;
           sMonitorLibHandle->Unload();
           delete sMonitorLibHandle; sMonitorLibHandle = 0;
+          __atomic_store_n( &sMonitorInitialized, true, __ATOMIC_RELEASE );
           return 0;
         }
         log->Debug( UtilityMsg, "Successfully initialized monitoring from: %s",
                     monitorLib.c_str() );
         delete [] errBuffer;
+
+        //----------------------------------------------------------------------
+        // Only mark the monitor as initialized once it is fully set up. The
+        // release store pairs with the acquire load above, so that threads
+        // skipping the lock see either no monitor or a ready one
+        //----------------------------------------------------------------------
+        __atomic_store_n( &sMonitorInitialized, true, __ATOMIC_RELEASE );
       }
     }
     return sMonitor;
@@ -201,11 +201,13 @@ bool AudioRendererAlgorithm::OutputFasterPlayback(uint8* dest,
   // d) Crossfade and output a frame.
   DCHECK_LT(index_into_window_, window_size_);
   int offset_into_buffer = index_into_window_ - intro_crossfade_begin;
-  memcpy(dest, crossfade_buffer_.get() + offset_into_buffer,
-         bytes_per_frame_);
-  scoped_array<uint8> intro_frame_ptr(new uint8[bytes_per_frame_]);
-  audio_buffer_.Read(intro_frame_ptr.get(), bytes_per_frame_);
-  OutputCrossfadedFrame(dest, intro_frame_ptr.get());
+  uint8* outtro_frame_ptr = crossfade_buffer_.get() + offset_into_buffer;
+  memcpy(dest, outtro_frame_ptr, bytes_per_frame_);
+  // The saved outtro frame is not needed again this window, so read the intro
+  // frame over it rather than allocating a scratch frame for every frame of
+  // the crossfade.
+  audio_buffer_.Read(outtro_frame_ptr, bytes_per_frame_);
+  OutputCrossfadedFrame(dest, outtro_frame_ptr);
   index_into_window_ += bytes_per_frame_;
   return true;
 }
@@ -9,6 +9,7 @@
 
 #include "base/bind.h"
 #include "base/bind_helpers.h"
+#include "base/containers/flat_set.h"
 #include "base/files/file.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
@@ -61,6 +62,9 @@ const int kBaseTableLen = 64 * 1024;
 // Avoid trimming the cache for the first 5 minutes (10 timer ticks).
 const int kTrimDelay = 10;
 
+// Typical number of hash chain links followed by MatchEntry().
+const size_t kMaxVisitedAddressesReserve = 8;
+
 int DesiredIndexTableLen(int32_t storage_size) {
   if (storage_size <= k64kEntriesStore)
     return kBaseTableLen;
@@ -1649,7 +1653,10 @@ scoped_refptr<EntryImpl> BackendImpl::MatchEntry(const std::string& key,
   Addr address(data_->table[hash & mask_]);
   scoped_refptr<EntryImpl> cache_entry, parent_entry;
   bool found = false;
-  std::set<CacheAddr> visited;
+  // Hash chains are short, so a sorted vector keeps loop detection from
+  // allocating a tree node for every address visited on each lookup.
+  base::flat_set<CacheAddr> visited;
+  visited.reserve(kMaxVisitedAddressesReserve);
   *match_error = false;
 
   for (;;) {
@@ -196,19 +196,22 @@ SessionCommand* BaseSessionService::CreateUpdateTabNavigationCommand(
         62, 100000, 50);
   }
 
-  std::string content_state;
+  // Point at the state to write instead of copying it; content states can be
+  // large and this runs for every navigation update of every tab.
+  const std::string empty_content_state;
+  const std::string* content_state = &empty_content_state;
 
   if (!save_post_data_) {
     // TODO(marja): This branch will be removed when saving the post data
     // becomes the default.
     if (entry.GetHasPostData())
-      content_state = content_state_without_post;
+      content_state = &content_state_without_post;
     else
-      content_state = entry.GetContentState();
+      content_state = &entry.GetContentState();
   }
   // Else: use an empty content state for keeping the data format compatible.
 
-  WriteStringToPickle(pickle, &bytes_written, max_state_size, content_state);
+  WriteStringToPickle(pickle, &bytes_written, max_state_size, *content_state);
 
   pickle.WriteInt(entry.GetTransitionType());
   int type_mask = entry.GetHasPostData() ? TabNavigation::HAS_POST_DATA : 0;
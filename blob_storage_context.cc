@@ -273,6 +273,16 @@ BlobStorageContext::BlobSlice::BlobSlice(const BlobEntry& source,
 
   size_t first_item_index = item_index;
 
+  // Every item between the ones holding the first and the last byte of the
+  // slice produces exactly one destination item, so reserve for them all.
+  if (slice_size > 0) {
+    size_t last_item_index =
+        std::upper_bound(offsets.begin(), offsets.end(),
+                         slice_offset + slice_size - 1) -
+        offsets.begin();
+    dest_items.reserve(last_item_index - first_item_index + 1);
+  }
+
   // Read starting from 'first_item_index' and 'item_offset'.
   for (uint64_t total_sliced = 0;
        item_index < num_items && total_sliced < slice_size; item_index++) {
@@ -254,12 +254,60 @@ void CoreNetwork::userInput(BufferInfo buf, QString msg)
 }
 
 
+// Bulk traffic (JOIN and WHO bursts on connect) may wait behind everything
+// else in the send queue.
+static bool isBulkCommand(const QByteArray &msg)
+{
+    return msg.startsWith("JOIN ") || msg.startsWith("WHO ");
+}
+
+
+// Channels named in the parameters of a raw line, lower-cased. The trailing
+// parameter is message text and is not searched.
+static QList<QByteArray> channelTargets(const QByteArray &msg)
+{
+    QList<QByteArray> channels;
+    int trailing = msg.indexOf(" :");
+    QList<QByteArray> params = (trailing >= 0 ? msg.left(trailing) : msg).split(' ');
+    for (int i = 1; i < params.count(); i++) {
+        foreach(const QByteArray &target, params.at(i).split(',')) {
+            if (!target.isEmpty() && QByteArray("#&+!").contains(target.at(0)))
+                channels << target.toLower();
+        }
+    }
+    return channels;
+}
+
+
 void CoreNetwork::putRawLine(QByteArray s)
 {
-    if (_tokenBucket > 0)
+    if (_tokenBucket > 0) {
         writeToSocket(s);
-    else
-        _msgQueue.append(s);
+        return;
+    }
+
+    // Queue non-bulk lines ahead of the bulk lines at the tail of the queue,
+    // so that interactive messages are not held up by hundreds of JOINs and
+    // WHOs. A line never overtakes a bulk line for one of its own channels,
+    // so e.g. a PRIVMSG or PART still goes out after the pending JOIN. The
+    // relative order within each class is kept.
+    int pos = _msgQueue.size();
+    if (!isBulkCommand(s)) {
+        QList<QByteArray> channels = channelTargets(s);
+        while (pos > 0 && isBulkCommand(_msgQueue.at(pos - 1))) {
+            bool sameChannel = false;
+            foreach(const QByteArray &channel, channelTargets(_msgQueue.at(pos - 1))) {
+                if (channels.contains(channel)) {
+                    sameChannel = true;
+                    break;
+                }
+            }
+            if (sameChannel)
+                break;
+            pos--;
+        }
+    }
+    _msgQueue.insert(pos, s);
 }
 
 
@@ -5,6 +5,9 @@
 #include "crazy_linker_zip.h"
 
 #include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -68,21 +71,6 @@ const int kOffsetExtraFieldLengthInLocalHeader =
 const int kOffsetFilenameInLocalHeader =
     kOffsetExtraFieldLengthInLocalHeader + 2;
 
-// RAII pattern for unmapping and closing the mapped file.
-class ScopedMMap {
- public:
-  ScopedMMap(void* mem, uint32_t len) : mem_(mem), len_(len) {}
-  ~ScopedMMap() {
-    if (munmap(mem_, len_) == -1) {
-      LOG_ERRNO("%s: munmap failed when trying to unmap zip file\n",
-                __FUNCTION__);
-    }
-  }
- private:
-  void* mem_;
-  uint32_t len_;
-};
-
 inline uint32_t ReadUInt16(uint8_t* mem_bytes, int offset) {
   return
       static_cast<uint32_t>(mem_bytes[offset]) |
@@ -97,50 +85,72 @@ inline uint32_t ReadUInt32(uint8_t* mem_bytes, int offset) {
       (static_cast<uint32_t>(mem_bytes[offset + 3]) << 24);
 }
 
-}  // unnamed namespace
-
-namespace crazy {
-
-const uint32_t kMaxZipFileLength = 1U << 31;  // 2GB
-
-int FindStartOffsetOfFileInZipFile(const char* zip_file, const char* filename) {
-  // Open the file
-  FileDescriptor fd;
-  if (!fd.OpenReadOnly(zip_file)) {
-    LOG_ERRNO("%s: open failed trying to open zip file %s\n",
-              __FUNCTION__, zip_file);
-    return CRAZY_OFFSET_FAILED;
+// FNV-1a, used to index central directory entries by file name.
+uint32_t HashFileName(const uint8_t* name, uint32_t length) {
+  uint32_t hash = 2166136261U;
+  for (uint32_t i = 0; i < length; ++i) {
+    hash ^= name[i];
+    hash *= 16777619U;
   }
+  return hash;
+}
 
-  // Find the length of the file.
-  struct stat stat_buf;
-  if (stat(zip_file, &stat_buf) == -1) {
-    LOG_ERRNO("%s: stat failed trying to stat zip file %s\n",
-              __FUNCTION__, zip_file);
-    return CRAZY_OFFSET_FAILED;
-  }
+// One central directory entry. The file name is copied into the index's
+// name buffer, so lookups do not need the zip file mapped.
+struct ZipEntry {
+  uint32_t hash;
+  uint32_t name_offset;
+  uint32_t name_length;
+  uint32_t local_header_offset;
+};
 
-  if (stat_buf.st_size > kMaxZipFileLength) {
-    LOG("%s: The size %ld of %s is too large to map\n",
-        __FUNCTION__, stat_buf.st_size, zip_file);
-    return CRAZY_OFFSET_FAILED;
-  }
+int CompareZipEntries(const void* a, const void* b) {
+  uint32_t hash_a = static_cast<const ZipEntry*>(a)->hash;
+  uint32_t hash_b = static_cast<const ZipEntry*>(b)->hash;
+  return hash_a < hash_b ? -1 : (hash_a > hash_b ? 1 : 0);
+}
 
-  // Map the file into memory.
-  void* mem = fd.Map(NULL, stat_buf.st_size, PROT_READ, MAP_PRIVATE, 0);
-  if (mem == MAP_FAILED) {
-    LOG_ERRNO("%s: mmap failed trying to mmap zip file %s\n",
-              __FUNCTION__, zip_file);
-    return CRAZY_OFFSET_FAILED;
-  }
-  ScopedMMap scoped_mmap(mem, stat_buf.st_size);
+// The central directory of the most recently used zip file, sorted by name
+// hash. Loading several libraries from the same APK only maps it and walks
+// its central directory once; the index is rebuilt when a different file is
+// requested or the file changed on disk. The file is unmapped as soon as the
+// index is built, so a large APK does not stay in the address space.
+struct ZipIndex {
+  char* path;
+  off_t size;
+  time_t mtime;
+  char* names;
+  ZipEntry* entries;
+  uint32_t num_entries;
+};
+
+ZipIndex g_zip_index = {NULL, 0, 0, NULL, NULL, 0};
+pthread_mutex_t g_zip_index_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void ReleaseZipIndex(ZipIndex* index) {
+  free(index->path);
+  delete[] index->names;
+  delete[] index->entries;
+  index->path = NULL;
+  index->size = 0;
+  index->mtime = 0;
+  index->names = NULL;
+  index->entries = NULL;
+  index->num_entries = 0;
+}
 
+// Fills |index| from the central directory of the zip file mapped at
+// |mem_bytes|. Returns false, after logging the reason, if the file is not
+// a usable zip.
+bool ParseZipIndex(uint8_t* mem_bytes,
+                   off_t size,
+                   const char* zip_file,
+                   ZipIndex* index) {
   // Scan backwards from the end of the file searching for the end of
   // central directory marker. The earliest occurrence we accept is
   // size of end of central directory bytes back from from the end of the
   // file.
-  uint8_t* mem_bytes = static_cast<uint8_t*>(mem);
-  int off = stat_buf.st_size - kEndOfCentralDirectoryRecordSize;
+  int off = size - kEndOfCentralDirectoryRecordSize;
   for (; off >= 0; --off) {
     if (ReadUInt32(mem_bytes, off) == kEndOfCentralDirectoryMarker) {
       break;
@@ -149,7 +159,7 @@ int FindStartOffsetOfFileInZipFile(const char* zip_file, const char* filename) {
   if (off == -1) {
     LOG("%s: Failed to find end of central directory in %s\n",
         __FUNCTION__, zip_file);
-    return CRAZY_OFFSET_FAILED;
+    return false;
   }
 
   // We have located the end of central directory record, now locate
@@ -163,30 +173,33 @@ int FindStartOffsetOfFileInZipFile(const char* zip_file, const char* filename) {
   if (start_of_central_dir > off) {
     LOG("%s: Found out of range offset %u for start of directory in %s\n",
         __FUNCTION__, start_of_central_dir, zip_file);
-    return CRAZY_OFFSET_FAILED;
+    return false;
   }
 
   uint32_t end_of_central_dir = start_of_central_dir + length_of_central_dir;
   if (end_of_central_dir > off) {
     LOG("%s: Found out of range offset %u for end of directory in %s\n",
         __FUNCTION__, end_of_central_dir, zip_file);
-    return CRAZY_OFFSET_FAILED;
+    return false;
   }
 
   uint32_t num_entries = ReadUInt16(
       mem_bytes, off + kOffsetNumOfEntriesInEndOfCentralDirectory);
 
-  // Read the headers in the central directory and locate the file.
+  // Read all the headers in the central directory. The names all lie
+  // within the central directory, so its length bounds the name buffer.
+  index->entries = new ZipEntry[num_entries];
+  index->names = new char[length_of_central_dir];
+  uint32_t names_length = 0;
   off = start_of_central_dir;
-  const int target_len = strlen(filename);
-  int n = 0;
+  uint32_t n = 0;
   for (; n < num_entries && off < end_of_central_dir; ++n) {
     uint32_t marker = ReadUInt32(mem_bytes, off);
     if (marker != kCentralDirHeaderMarker) {
       LOG("%s: Failed to find central directory header marker in %s. "
           "Found 0x%x but expected 0x%x\n", __FUNCTION__,
           zip_file, marker, kCentralDirHeaderMarker);
-      return CRAZY_OFFSET_FAILED;
+      return false;
     }
     uint32_t file_name_length =
         ReadUInt16(mem_bytes, off + kOffsetFilenameLengthInCentralDirectory);
@@ -197,50 +210,26 @@ int FindStartOffsetOfFileInZipFile(const char* zip_file, const char* filename) {
     uint32_t header_length = kOffsetFilenameInCentralDirectory +
         file_name_length + extra_field_length + comment_field_length;
 
-    uint32_t local_header_offset =
-        ReadUInt32(mem_bytes, off + kOffsetLocalHeaderOffsetInCentralDirectory);
-
-    uint8_t* filename_bytes =
-        mem_bytes + off + kOffsetFilenameInCentralDirectory;
-
-    if (file_name_length == target_len &&
-        memcmp(filename_bytes, filename, target_len) == 0) {
-      // Filename matches. Read the local header and compute the offset.
-      uint32_t marker = ReadUInt32(mem_bytes, local_header_offset);
-      if (marker != kLocalHeaderMarker) {
-        LOG("%s: Failed to find local file header marker in %s. "
-            "Found 0x%x but expected 0x%x\n", __FUNCTION__,
-            zip_file, marker, kLocalHeaderMarker);
-        return CRAZY_OFFSET_FAILED;
-      }
-
-      uint32_t compression_method =
-          ReadUInt16(
-              mem_bytes,
-              local_header_offset + kOffsetCompressionMethodInLocalHeader);
-      if (compression_method != kCompressionMethodStored) {
-        LOG("%s: %s is compressed within %s. "
-            "Found compression method %u but expected %u\n", __FUNCTION__,
-            filename, zip_file, compression_method, kCompressionMethodStored);
-        return CRAZY_OFFSET_FAILED;
-      }
-
-      uint32_t file_name_length =
-          ReadUInt16(
-              mem_bytes,
-              local_header_offset + kOffsetFilenameLengthInLocalHeader);
-      uint32_t extra_field_length =
-          ReadUInt16(
-              mem_bytes,
-              local_header_offset + kOffsetExtraFieldLengthInLocalHeader);
-      uint32_t header_length =
-          kOffsetFilenameInLocalHeader + file_name_length + extra_field_length;
-
-      return local_header_offset + header_length;
+    if (off + kOffsetFilenameInCentralDirectory + file_name_length >
+        end_of_central_dir) {
+      LOG("%s: Found out of range file name in the central directory of %s\n",
+          __FUNCTION__, zip_file);
+      return false;
     }
 
+    ZipEntry& entry = index->entries[n];
+    const uint8_t* name = mem_bytes + off + kOffsetFilenameInCentralDirectory;
+    memcpy(index->names + names_length, name, file_name_length);
+    entry.name_offset = names_length;
+    entry.name_length = file_name_length;
+    entry.hash = HashFileName(name, file_name_length);
+    entry.local_header_offset =
+        ReadUInt32(mem_bytes, off + kOffsetLocalHeaderOffsetInCentralDirectory);
+    names_length += file_name_length;
+
     off += header_length;
   }
+  index->num_entries = n;
 
   if (n < num_entries) {
     LOG("%s: Did not find all the expected entries in the central directory. "
@@ -252,8 +241,171 @@ int FindStartOffsetOfFileInZipFile(const char* zip_file, const char* filename) {
         __FUNCTION__, end_of_central_dir - off);
   }
 
-  LOG("%s: Did not find %s in %s\n", __FUNCTION__, filename, zip_file);
-  return CRAZY_OFFSET_FAILED;
+  qsort(index->entries, index->num_entries, sizeof(ZipEntry),
+        CompareZipEntries);
+  return true;
+}
+
+// Maps |zip_file|, fills |index| from its central directory and unmaps it
+// again. Returns false, after logging the reason, if the file is not a
+// usable zip.
+bool BuildZipIndex(const char* zip_file,
+                   const struct stat& stat_buf,
+                   ZipIndex* index) {
+  // Open the file
+  crazy::FileDescriptor fd;
+  if (!fd.OpenReadOnly(zip_file)) {
+    LOG_ERRNO("%s: open failed trying to open zip file %s\n",
+              __FUNCTION__, zip_file);
+    return false;
+  }
+
+  // Map the file into memory.
+  void* mem = fd.Map(NULL, stat_buf.st_size, PROT_READ, MAP_PRIVATE, 0);
+  if (mem == MAP_FAILED) {
+    LOG_ERRNO("%s: mmap failed trying to mmap zip file %s\n",
+              __FUNCTION__, zip_file);
+    return false;
+  }
+  index->size = stat_buf.st_size;
+
+  bool result = ParseZipIndex(
+      static_cast<uint8_t*>(mem), stat_buf.st_size, zip_file, index);
+
+  if (munmap(mem, stat_buf.st_size) == -1) {
+    LOG_ERRNO("%s: munmap failed when trying to unmap zip file %s\n",
+              __FUNCTION__, zip_file);
+  }
+  return result;
+}
+
+// Reads the local header of |entry| from |zip_file| and returns the offset of
+// its data. Only the matched entry's header is read, so building the index
+// does not touch the rest of the file.
+int FindStartOffsetOfEntry(const ZipIndex& index,
+                           const ZipEntry& entry,
+                           const char* zip_file,
+                           const char* filename) {
+  uint32_t local_header_offset = entry.local_header_offset;
+  if (index.size < kOffsetFilenameInLocalHeader ||
+      local_header_offset > index.size - kOffsetFilenameInLocalHeader) {
+    LOG("%s: Found out of range local header offset %u in %s\n",
+        __FUNCTION__, local_header_offset, zip_file);
+    return CRAZY_OFFSET_FAILED;
+  }
+
+  crazy::FileDescriptor fd;
+  if (!fd.OpenReadOnly(zip_file)) {
+    LOG_ERRNO("%s: open failed trying to open zip file %s\n",
+              __FUNCTION__, zip_file);
+    return CRAZY_OFFSET_FAILED;
+  }
+
+  uint8_t header[kOffsetFilenameInLocalHeader];
+  if (fd.SeekTo(local_header_offset) == -1 ||
+      fd.Read(header, sizeof(header)) != static_cast<int>(sizeof(header))) {
+    LOG_ERRNO("%s: failed to read local header at offset %u in %s\n",
+              __FUNCTION__, local_header_offset, zip_file);
+    return CRAZY_OFFSET_FAILED;
+  }
+
+  uint32_t marker = ReadUInt32(header, 0);
+  if (marker != kLocalHeaderMarker) {
+    LOG("%s: Failed to find local file header marker in %s. "
+        "Found 0x%x but expected 0x%x\n", __FUNCTION__,
+        zip_file, marker, kLocalHeaderMarker);
+    return CRAZY_OFFSET_FAILED;
+  }
+
+  uint32_t compression_method =
+      ReadUInt16(header, kOffsetCompressionMethodInLocalHeader);
+  if (compression_method != kCompressionMethodStored) {
+    LOG("%s: %s is compressed within %s. "
+        "Found compression method %u but expected %u\n", __FUNCTION__,
+        filename, zip_file, compression_method, kCompressionMethodStored);
+    return CRAZY_OFFSET_FAILED;
+  }
+
+  uint32_t file_name_length =
+      ReadUInt16(header, kOffsetFilenameLengthInLocalHeader);
+  uint32_t extra_field_length =
+      ReadUInt16(header, kOffsetExtraFieldLengthInLocalHeader);
+  uint32_t header_length =
+      kOffsetFilenameInLocalHeader + file_name_length + extra_field_length;
+
+  return local_header_offset + header_length;
+}
+
+}  // unnamed namespace
+
+namespace crazy {
+
+const uint32_t kMaxZipFileLength = 1U << 31;  // 2GB
+
+int FindStartOffsetOfFileInZipFile(const char* zip_file, const char* filename) {
+  // Find the length of the file.
+  struct stat stat_buf;
+  if (stat(zip_file, &stat_buf) == -1) {
+    LOG_ERRNO("%s: stat failed trying to stat zip file %s\n",
+              __FUNCTION__, zip_file);
+    return CRAZY_OFFSET_FAILED;
+  }
+
+  if (stat_buf.st_size > kMaxZipFileLength) {
+    LOG("%s: The size %ld of %s is too large to map\n",
+        __FUNCTION__, stat_buf.st_size, zip_file);
+    return CRAZY_OFFSET_FAILED;
+  }
+
+  pthread_mutex_lock(&g_zip_index_lock);
+
+  ZipIndex& index = g_zip_index;
+  if (!index.path || strcmp(index.path, zip_file) != 0 ||
+      index.size != stat_buf.st_size || index.mtime != stat_buf.st_mtime) {
+    ReleaseZipIndex(&index);
+    if (!BuildZipIndex(zip_file, stat_buf, &index)) {
+      ReleaseZipIndex(&index);
+      pthread_mutex_unlock(&g_zip_index_lock);
+      return CRAZY_OFFSET_FAILED;
+    }
+    index.path = strdup(zip_file);
+    index.mtime = stat_buf.st_mtime;
+  }
+
+  // Binary search for the first entry with a matching hash, then compare
+  // the names of all entries sharing it.
+  const uint32_t target_len = strlen(filename);
+  const uint32_t target_hash = HashFileName(
+      reinterpret_cast<const uint8_t*>(filename), target_len);
+  uint32_t lo = 0;
+  uint32_t hi = index.num_entries;
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (index.entries[mid].hash < target_hash)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  int result = CRAZY_OFFSET_FAILED;
+  bool found = false;
+  for (uint32_t n = lo;
+       n < index.num_entries && index.entries[n].hash == target_hash; ++n) {
+    const ZipEntry& entry = index.entries[n];
+    if (entry.name_length == target_len &&
+        memcmp(index.names + entry.name_offset, filename, target_len) == 0) {
+      // Filename matches. Read the local header and compute the offset.
+      result = FindStartOffsetOfEntry(index, entry, zip_file, filename);
+      found = true;
+      break;
+    }
+  }
+
+  pthread_mutex_unlock(&g_zip_index_lock);
+
+  if (!found)
+    LOG("%s: Did not find %s in %s\n", __FUNCTION__, filename, zip_file);
+  return result;
 }
 
 }  // crazy namespace
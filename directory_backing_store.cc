@@ -93,6 +93,38 @@ int BindFields(const EntryKernel& entry,
   return index;
 }
 
+// Builds the INSERT OR REPLACE statement that writes every column of a
+// metas row.  The text only depends on the schema, so callers that save many
+// entries can prepare it once and rebind it per entry.
+void AppendSaveEntryQuery(string* query) {
+  query->reserve(kUpdateStatementBufferSize);
+  query->append("INSERT OR REPLACE INTO metas ");
+  string values;
+  values.reserve(kUpdateStatementBufferSize);
+  values.append("VALUES ");
+  const char* separator = "( ";
+  for (int i = BEGIN_FIELDS; i < PROTO_FIELDS_END; ++i) {
+    query->append(separator);
+    values.append(separator);
+    separator = ", ";
+    query->append(ColumnName(i));
+    values.append("?");
+  }
+  query->append(" ) ");
+  values.append(" )");
+  query->append(values);
+}
+
+// Binds |entry| to the prepared save |statement| and runs it.  The statement
+// is reset afterwards so that it can be reused for the next entry.
+bool SaveEntryWithStatement(const EntryKernel& entry,
+                            sqlite_utils::SQLStatement* statement) {
+  BindFields(entry, statement);
+  return (SQLITE_DONE == statement->step() &&
+          SQLITE_OK == statement->reset() &&
+          1 == statement->changes());
+}
+
 // The caller owns the returned EntryKernel*.
 int UnpackEntry(sqlite_utils::SQLStatement* statement, EntryKernel** kernel) {
   *kernel = NULL;
@@ -364,11 +396,20 @@ bool DirectoryBackingStore::SaveChanges(
   if (SQLITE_OK != transaction.BeginExclusive())
     return false;
 
-  for (EntryKernelSet::const_iterator i = snapshot.dirty_metas.begin();
-       i != snapshot.dirty_metas.end(); ++i) {
-    DCHECK(i->is_dirty());
-    if (!SaveEntryToDB(*i))
+  if (!snapshot.dirty_metas.empty()) {
+    // Prepare the save statement once and rebind it for every dirty entry,
+    // rather than rebuilding and recompiling the same SQL per entry.
+    string query;
+    AppendSaveEntryQuery(&query);
+    sqlite_utils::SQLStatement save_entry;
+    if (SQLITE_OK != save_entry.prepare(dbhandle, query.c_str()))
       return false;
+    for (EntryKernelSet::const_iterator i = snapshot.dirty_metas.begin();
+         i != snapshot.dirty_metas.end(); ++i) {
+      DCHECK(i->is_dirty());
+      if (!SaveEntryWithStatement(*i, &save_entry))
+        return false;
+    }
   }
 
   if (!DeleteEntries(snapshot.metahandles_to_purge))
@@ -393,10 +434,10 @@ bool DirectoryBackingStore::SaveChanges(
       return false;
     }
 
+    sqlite_utils::SQLStatement op;
+    op.prepare(dbhandle, "INSERT OR REPLACE INTO models (model_id, "
+    "progress_marker, initial_sync_ended) VALUES ( ?, ?, ?)");
     for (int i = FIRST_REAL_MODEL_TYPE; i < MODEL_TYPE_COUNT; ++i) {
-      sqlite_utils::SQLStatement op;
-      op.prepare(dbhandle, "INSERT OR REPLACE INTO models (model_id, "
-      "progress_marker, initial_sync_ended) VALUES ( ?, ?, ?)");
       // We persist not ModelType but rather a protobuf-derived ID.
       string model_id = ModelTypeEnumToModelId(ModelTypeFromInt(i));
       string progress_marker;
@@ -634,30 +675,10 @@ bool DirectoryBackingStore::LoadInfo(Directory::KernelLoadInfo* info) {
 bool DirectoryBackingStore::SaveEntryToDB(const EntryKernel& entry) {
   DCHECK(save_dbhandle_);
   string query;
-  query.reserve(kUpdateStatementBufferSize);
-  query.append("INSERT OR REPLACE INTO metas ");
-  string values;
-  values.reserve(kUpdateStatementBufferSize);
-  values.append("VALUES ");
-  const char* separator = "( ";
-  int i = 0;
-  for (i = BEGIN_FIELDS; i < PROTO_FIELDS_END; ++i) {
-    query.append(separator);
-    values.append(separator);
-    separator = ", ";
-    query.append(ColumnName(i));
-    values.append("?");
-  }
-
-  query.append(" ) ");
-  values.append(" )");
-  query.append(values);
+  AppendSaveEntryQuery(&query);
   sqlite_utils::SQLStatement statement;
   statement.prepare(save_dbhandle_, query.c_str());
-  BindFields(entry, &statement);
-  return (SQLITE_DONE == statement.step() &&
-          SQLITE_OK == statement.reset() &&
-          1 == statement.changes());
+  return SaveEntryWithStatement(entry, &statement);
 }
 
 bool DirectoryBackingStore::DropDeletedEntries() {
@@ -152,10 +152,13 @@ TypedValue HHVM_FUNCTION(array_column,
 
     if (idx.isNull() || !sub.exists(idx)) {
       ret.append(elem);
-    } else if (sub[idx].isObject()) {
-      ret.setUnknownKey(sub[idx].toString(), elem);
+      continue;
+    }
+    auto const key = sub[idx];
+    if (key.isObject()) {
+      ret.setUnknownKey(key.toString(), elem);
     } else {
-      ret.setUnknownKey(sub[idx], elem);
+      ret.setUnknownKey(key, elem);
     }
   }
   return tvReturn(ret.toVariant());
@@ -204,6 +207,11 @@ TypedValue HHVM_FUNCTION(array_fill_keys,
                        ai.emplace(adata->size(), ArrayInit::Mixed{});
                      },
                      [&](const TypedValue* tv) {
+                       if (tv->m_type == KindOfInt64) {
+                         // no key conversion needed for integer keys
+                         ai->set(tv->m_data.num, value);
+                         return;
+                       }
                        auto& key = tvAsCVarRef(tv);
                        if (key.isInteger() || key.isString()) {
                          ai->setUnknownKey(key, value);
@@ -266,7 +274,10 @@ TypedValue HHVM_FUNCTION(array_flip,
   ArrayInit ret(getContainerSize(transCell), ArrayInit::Mixed{});
   for (ArrayIter iter(transCell); iter; ++iter) {
     const Variant& value(iter.secondRefPlus());
-    if (value.isString() || value.isInteger()) {
+    auto const& valueCell = *value.asCell();
+    if (valueCell.m_type == KindOfInt64) {
+      ret.set(valueCell.m_data.num, iter.first());
+    } else if (value.isString() || value.isInteger()) {
       ret.setUnknownKey(value, iter.first());
     } else {
       raise_warning("Can only flip STRING and INTEGER values!");
@@ -203,6 +203,12 @@ static HashEnginePtr php_hash_fetch_ops(const String& algo) {
   return iter->second;
 }
 
+/*
+ * Size of the reads done by hash_file(). Large reads amortize the
+ * stream layer and the per-call setup of the hash engines.
+ */
+const int64_t kHashFileChunkSize = 64 * 1024;
+
 static Variant php_hash_do_hash(const String& algo, const String& data,
                                 bool isfilename,
                                 bool raw_output) {
@@ -223,9 +229,9 @@ static Variant php_hash_do_hash(const String& algo, const String& data,
   ops->hash_init(context);
 
   if (isfilename) {
-    for (Variant chunk = f_fread(f.toResource(), 1024);
+    for (Variant chunk = f_fread(f.toResource(), kHashFileChunkSize);
          !is_empty_string(chunk);
-         chunk = f_fread(f.toResource(), 1024)) {
+         chunk = f_fread(f.toResource(), kHashFileChunkSize)) {
       String schunk = chunk.toString();
       ops->hash_update(context, (unsigned char *)schunk.data(), schunk.size());
     }
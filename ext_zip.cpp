@@ -16,6 +16,8 @@
 */
 #include <zip.h>
 
+#include <memory>
+
 #include "hphp/runtime/base/array-init.h"
 #include "hphp/runtime/base/file-util.h"
 #include "hphp/runtime/base/preg.h"
@@ -798,13 +800,16 @@ static bool HHVM_METHOD(ZipArchive, extractTo, const String& destination,
     return false;
   }
 
-  char buf[1024];
+  // Entries are inflated straight into the destination file; a large
+  // buffer keeps the number of zip_fread/fwrite calls per entry low.
+  const size_t bufSize = 256 * 1024;
+  std::unique_ptr<char[]> buf(new char[bufSize]);
   auto toSize = to.size();
 
   if (entries.isString()) {
     // extract only this file
     if (!extractFileTo(zipDir->getZip(), entries.asCStrRef().c_str(),
-                       to, buf, sizeof(buf))) {
+                       to, buf.get(), bufSize)) {
       return false;
     }
   } else if (entries.isArray() && entries.asCArrRef().size() != 0) {
@@ -813,7 +818,7 @@ static bool HHVM_METHOD(ZipArchive, extractTo, const String& destination,
       auto var = it.second();
       if (!var.isString() || !extractFileTo(zipDir->getZip(),
                                             var.asCStrRef().c_str(),
-                                            to, buf, sizeof(buf))) {
+                                            to, buf.get(), bufSize)) {
         return false;
       }
       to.resize(toSize);
@@ -822,7 +827,7 @@ static bool HHVM_METHOD(ZipArchive, extractTo, const String& destination,
     // extract all files
     for (decltype(fileCount) index = 0; index < fileCount; ++index) {
       auto file = zip_get_name(zipDir->getZip(), index, ZIP_FL_UNCHANGED);
-      if (!extractFileTo(zipDir->getZip(), file, to, buf, sizeof(buf))) {
+      if (!extractFileTo(zipDir->getZip(), file, to, buf.get(), bufSize)) {
         return false;
       }
       to.resize(toSize);
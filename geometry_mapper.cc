@@ -319,7 +319,7 @@ FloatClipRect GeometryMapper::LocalToAncestorClipRectInternal(
 
   FloatClipRect clip;
   const ClipPaintPropertyNode* clip_node = descendant;
-  Vector<const ClipPaintPropertyNode*> intermediate_nodes;
+  Vector<const ClipPaintPropertyNode*, 8> intermediate_nodes;
 
   GeometryMapperClipCache::ClipAndTransform clip_and_transform(
       ancestor_clip, ancestor_transform, clip_behavior);
@@ -356,21 +356,30 @@ FloatClipRect GeometryMapper::LocalToAncestorClipRectInternal(
   }
 
   // Iterate down from the top intermediate node found in the previous loop,
-  // computing and memoizing clip rects as we go.
+  // computing and memoizing clip rects as we go. Consecutive clips commonly
+  // share a local transform space (e.g. nested overflow clips without
+  // transforms in between). In that case the projection is the same, so reuse
+  // it instead of walking the transform caches again. The returned reference
+  // may point to a shared temporary, which stays valid until the next call.
+  const TransformPaintPropertyNode* last_transform_space = nullptr;
+  const TransformationMatrix* transform_matrix = nullptr;
   for (auto it = intermediate_nodes.rbegin(); it != intermediate_nodes.rend();
        ++it) {
-    const TransformationMatrix& transform_matrix =
-        SourceToDestinationProjectionInternal((*it)->LocalTransformSpace(),
-                                              ancestor_transform, success);
-    if (!success) {
-      success = true;
-      return FloatClipRect(FloatRect());
+    const auto* transform_space = (*it)->LocalTransformSpace();
+    if (transform_space != last_transform_space) {
+      transform_matrix = &SourceToDestinationProjectionInternal(
+          transform_space, ancestor_transform, success);
+      if (!success) {
+        success = true;
+        return FloatClipRect(FloatRect());
+      }
+      last_transform_space = transform_space;
     }
 
     // This is where we generate the roundedness and tightness of clip rect
     // from clip and transform properties, and propagate them to |clip|.
     FloatClipRect mapped_rect(GetClipRect((*it), clip_behavior));
-    mapped_rect.Map(transform_matrix);
+    mapped_rect.Map(*transform_matrix);
     if (inclusive_behavior == kInclusiveIntersect) {
       clip.InclusiveIntersect(mapped_rect);
     } else {
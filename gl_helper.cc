@@ -4,6 +4,7 @@
 
 #include "content/common/gpu/client/gl_helper.h"
 
+#include <algorithm>
 #include <queue>
 
 #include "base/bind.h"
@@ -448,73 +449,115 @@ WebGLId GLHelper::CopyTextureToImpl::ScaleTexture(
     const gfx::Rect& src_subrect,
     const gfx::Size& dst_size,
     bool vertically_flip_texture) {
-  WebGLId dst_texture = context_->createTexture();
-  {
-    ScopedFramebuffer dst_framebuffer(context_, context_->createFramebuffer());
-    ScopedFramebufferBinder<GL_FRAMEBUFFER> framebuffer_binder(
-        context_, dst_framebuffer);
+  // Bilinear filtering only samples a 2x2 footprint, so a single pass that
+  // shrinks by more than a factor of two skips source texels and aliases.
+  // Halve the image in intermediate passes until it is within 2x of
+  // |dst_size|, then draw the final pass (with the requested flip).
+  WebGLId pass_texture = src_texture;
+  gfx::Size pass_size = src_size;
+  gfx::Rect pass_subrect = src_subrect;
+  for (;;) {
+    gfx::Size halved_size(
+        std::max((pass_subrect.width() + 1) / 2, dst_size.width()),
+        std::max((pass_subrect.height() + 1) / 2, dst_size.height()));
+    // An empty |dst_size| never comes within 2x, and a pass that cannot
+    // shrink the image any further makes no progress, so draw the final
+    // pass directly in both cases.
+    bool final_pass = dst_size.IsEmpty() ||
+        halved_size == pass_subrect.size() ||
+        (pass_subrect.width() <= 2 * dst_size.width() &&
+         pass_subrect.height() <= 2 * dst_size.height());
+    gfx::Size target_size = final_pass ? dst_size : halved_size;
+
+    WebGLId dst_texture = context_->createTexture();
     {
-      ScopedTextureBinder<GL_TEXTURE_2D> texture_binder(
-          context_, dst_texture);
-      context_->texImage2D(GL_TEXTURE_2D,
-                           0,
-                           GL_RGBA,
-                           dst_size.width(),
-                           dst_size.height(),
-                           0,
-                           GL_RGBA,
-                           GL_UNSIGNED_BYTE,
-                           NULL);
-      context_->framebufferTexture2D(GL_FRAMEBUFFER,
-                                     GL_COLOR_ATTACHMENT0,
-                                     GL_TEXTURE_2D,
-                                     dst_texture,
-                                     0);
+      ScopedFramebuffer dst_framebuffer(context_,
+                                        context_->createFramebuffer());
+      ScopedFramebufferBinder<GL_FRAMEBUFFER> framebuffer_binder(
+          context_, dst_framebuffer);
+      {
+        ScopedTextureBinder<GL_TEXTURE_2D> texture_binder(
+            context_, dst_texture);
+        // Intermediate textures are sampled by the next pass, so they need
+        // linear filtering and must not require mipmaps to be complete.
+        context_->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                                GL_LINEAR);
+        context_->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+                                GL_LINEAR);
+        context_->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
+                                GL_CLAMP_TO_EDGE);
+        context_->texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
+                                GL_CLAMP_TO_EDGE);
+        context_->texImage2D(GL_TEXTURE_2D,
+                             0,
+                             GL_RGBA,
+                             target_size.width(),
+                             target_size.height(),
+                             0,
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             NULL);
+        context_->framebufferTexture2D(GL_FRAMEBUFFER,
+                                       GL_COLOR_ATTACHMENT0,
+                                       GL_TEXTURE_2D,
+                                       dst_texture,
+                                       0);
+      }
+
+      ScopedTextureBinder<GL_TEXTURE_2D> texture_binder(context_,
+                                                        pass_texture);
+      WebKit::WebGLId vertex_attributes_buffer =
+          final_pass && vertically_flip_texture ?
+          flipped_vertex_attributes_buffer_ : vertex_attributes_buffer_;
+      ScopedBufferBinder<GL_ARRAY_BUFFER> buffer_binder(
+          context_, vertex_attributes_buffer);
+
+      context_->viewport(0, 0, target_size.width(), target_size.height());
+      context_->useProgram(program_);
+
+      WebKit::WGC3Dintptr offset = 0;
+      context_->vertexAttribPointer(position_location_,
+                                    2,
+                                    GL_FLOAT,
+                                    GL_FALSE,
+                                    4 * sizeof(WebKit::WGC3Dfloat),
+                                    offset);
+      context_->enableVertexAttribArray(position_location_);
+
+      offset += 2 * sizeof(WebKit::WGC3Dfloat);
+      context_->vertexAttribPointer(texcoord_location_,
+                                    2,
+                                    GL_FLOAT,
+                                    GL_FALSE,
+                                    4 * sizeof(WebKit::WGC3Dfloat),
+                                    offset);
+      context_->enableVertexAttribArray(texcoord_location_);
+
+      context_->uniform1i(texture_location_, 0);
+
+      // Convert |pass_subrect| to texture coordinates.
+      GLfloat src_subrect_texcoord[] = {
+        static_cast<float>(pass_subrect.x()) / pass_size.width(),
+        static_cast<float>(pass_subrect.y()) / pass_size.height(),
+        static_cast<float>(pass_subrect.width()) / pass_size.width(),
+        static_cast<float>(pass_subrect.height()) / pass_size.height(),
+      };
+
+      context_->uniform4fv(src_subrect_location_, 1, src_subrect_texcoord);
+
+      // Conduct texture mapping by drawing a quad composed of two triangles.
+      context_->drawArrays(GL_TRIANGLE_STRIP, 0, 4);
     }
 
-    ScopedTextureBinder<GL_TEXTURE_2D> texture_binder(context_, src_texture);
-    WebKit::WebGLId vertex_attributes_buffer = vertically_flip_texture ?
-        flipped_vertex_attributes_buffer_ : vertex_attributes_buffer_;
-    ScopedBufferBinder<GL_ARRAY_BUFFER> buffer_binder(
-        context_, vertex_attributes_buffer);
-
-    context_->viewport(0, 0, dst_size.width(), dst_size.height());
-    context_->useProgram(program_);
-
-    WebKit::WGC3Dintptr offset = 0;
-    context_->vertexAttribPointer(position_location_,
-                                  2,
-                                  GL_FLOAT,
-                                  GL_FALSE,
-                                  4 * sizeof(WebKit::WGC3Dfloat),
-                                  offset);
-    context_->enableVertexAttribArray(position_location_);
-
-    offset += 2 * sizeof(WebKit::WGC3Dfloat);
-    context_->vertexAttribPointer(texcoord_location_,
-                                  2,
-                                  GL_FLOAT,
-                                  GL_FALSE,
-                                  4 * sizeof(WebKit::WGC3Dfloat),
-                                  offset);
-    context_->enableVertexAttribArray(texcoord_location_);
-
-    context_->uniform1i(texture_location_, 0);
-
-    // Convert |src_subrect| to texture coordinates.
-    GLfloat src_subrect_texcoord[] = {
-      static_cast<float>(src_subrect.x()) / src_size.width(),
-      static_cast<float>(src_subrect.y()) / src_size.height(),
-      static_cast<float>(src_subrect.width()) / src_size.width(),
-      static_cast<float>(src_subrect.height()) / src_size.height(),
-    };
-
-    context_->uniform4fv(src_subrect_location_, 1, src_subrect_texcoord);
-
-    // Conduct texture mapping by drawing a quad composed of two triangles.
-    context_->drawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    if (pass_texture != src_texture)
+      context_->deleteTexture(pass_texture);
+    if (final_pass)
+      return dst_texture;
+
+    pass_texture = dst_texture;
+    pass_size = target_size;
+    pass_subrect = gfx::Rect(target_size);
   }
-  return dst_texture;
 }
 
 void GLHelper::CopyTextureToImpl::DeleteContextForThread() {
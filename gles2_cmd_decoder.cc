@@ -2660,6 +2660,10 @@ void GLES2DecoderImpl::DoActiveTexture(GLenum texture_unit) {
     SetGLError(GL_INVALID_ENUM, "glActiveTexture: texture_unit out of range.");
     return;
   }
+  // Internal changes to the active unit are always restored, so the driver's
+  // state matches |active_texture_unit_| here.
+  if (texture_index == active_texture_unit_)
+    return;
   active_texture_unit_ = texture_index;
   glActiveTexture(texture_unit);
 }
@@ -2857,23 +2861,29 @@ void GLES2DecoderImpl::DoBindTexture(GLenum target, GLuint client_id) {
   if (info->target() == 0) {
     texture_manager()->SetInfoTarget(info, target);
   }
-  glBindTexture(target, info->service_id());
   TextureUnit& unit = texture_units_[active_texture_unit_];
   unit.bind_target = target;
+  TextureManager::TextureInfo::Ref* bound_texture = NULL;
   switch (target) {
     case GL_TEXTURE_2D:
-      unit.bound_texture_2d = info;
+      bound_texture = &unit.bound_texture_2d;
       break;
     case GL_TEXTURE_CUBE_MAP:
-      unit.bound_texture_cube_map = info;
+      bound_texture = &unit.bound_texture_cube_map;
       break;
     case GL_TEXTURE_EXTERNAL_OES:
-      unit.bound_texture_external_oes = info;
+      bound_texture = &unit.bound_texture_external_oes;
       break;
     default:
       NOTREACHED();  // Validation should prevent us getting here.
-      break;
+      return;
   }
+  // Rebinding the texture that is already bound to this unit and target is a
+  // no-op; don't pass it on to the driver.
+  if (*bound_texture == info)
+    return;
+  *bound_texture = info;
+  glBindTexture(target, info->service_id());
 }
 
 void GLES2DecoderImpl::DoDisableVertexAttribArray(GLuint index) {
@@ -4097,6 +4107,8 @@ void GLES2DecoderImpl::DoUseProgram(GLuint program) {
     }
     service_id = info->service_id();
   }
+  if (current_program_ == info)
+    return;
   if (current_program_) {
     program_manager()->UnuseProgram(shader_manager(), current_program_);
   }
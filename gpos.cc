@@ -4,6 +4,7 @@
 
 #include "gpos.h"
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -164,6 +165,26 @@ bool ParseAnchorTable(const ots::OpenTypeFile *file,
   return true;
 }
 
+// Parses the anchor table at |offset| unless an earlier record of the same
+// array already pointed at it. Fonts commonly share one anchor table across
+// many marks or base glyphs, and its validity only depends on the offset.
+bool ParseAnchorTableAt(const ots::OpenTypeFile *file,
+                        const uint8_t *data, const size_t length,
+                        const uint16_t offset, std::vector<bool> *parsed) {
+  if (parsed->empty()) {
+    parsed->resize(std::min<size_t>(length,
+                                    std::numeric_limits<uint16_t>::max() + 1));
+  }
+  if ((*parsed)[offset]) {
+    return true;
+  }
+  if (!ParseAnchorTable(file, data + offset, length - offset)) {
+    return false;
+  }
+  (*parsed)[offset] = true;
+  return true;
+}
+
 bool ParseMarkArrayTable(const ots::OpenTypeFile *file,
                          const uint8_t *data, const size_t length,
                          const uint16_t class_count) {
@@ -179,6 +200,7 @@ bool ParseMarkArrayTable(const ots::OpenTypeFile *file,
   if (mark_records_end > std::numeric_limits<uint16_t>::max()) {
     return OTS_FAILURE_MSG("Bad mark table length");
   }
+  std::vector<bool> parsed_anchors;
   for (unsigned i = 0; i < mark_count; ++i) {
     uint16_t class_value = 0;
     uint16_t offset_mark_anchor = 0;
@@ -192,8 +214,8 @@ bool ParseMarkArrayTable(const ots::OpenTypeFile *file,
         offset_mark_anchor >= length) {
       return OTS_FAILURE_MSG("Bad mark anchor offset %d for mark table %d", offset_mark_anchor, i);
     }
-    if (!ParseAnchorTable(file, data + offset_mark_anchor,
-                          length - offset_mark_anchor)) {
+    if (!ParseAnchorTableAt(file, data, length, offset_mark_anchor,
+                            &parsed_anchors)) {
       return OTS_FAILURE_MSG("Faled to parse anchor table for mark table %d", i);
     }
   }
@@ -500,6 +522,7 @@ bool ParseAnchorArrayTable(const ots::OpenTypeFile *file,
   if (anchor_array_end > std::numeric_limits<uint16_t>::max()) {
     return OTS_FAILURE_MSG("Bad end of anchor array %d", anchor_array_end);
   }
+  std::vector<bool> parsed_anchors;
   for (unsigned i = 0; i < record_count; ++i) {
     for (unsigned j = 0; j < class_count; ++j) {
       uint16_t offset_record = 0;
@@ -511,8 +534,8 @@ bool ParseAnchorArrayTable(const ots::OpenTypeFile *file,
         if (offset_record < anchor_array_end || offset_record >= length) {
           return OTS_FAILURE_MSG("Bad record offset %d in class %d, record %d", offset_record, j, i);
         }
-        if (!ParseAnchorTable(file, data + offset_record,
-                              length - offset_record)) {
+        if (!ParseAnchorTableAt(file, data, length, offset_record,
+                                &parsed_anchors)) {
           return OTS_FAILURE_MSG("Failed to parse anchor table for class %d, record %d", j, i);
         }
       }
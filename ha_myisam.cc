@@ -1085,11 +1085,22 @@ int ha_myisam::repair(THD *thd, MI_CHECK &param, bool do_optimize)
       local_testflag|= T_STATISTICS;
       param.testflag|= T_STATISTICS;		// We get this for free
       statistics_done=1;
-      if (THDVAR(thd, repair_threads)>1)
+      /*
+        Only the indexes that are actually rebuilt get a sort thread:
+        with T_CREATE_MISSING_KEYS those are the disabled ones. A parallel
+        repair of a single index just adds thread and cache sharing
+        overhead on top of a plain repair by sort.
+      */
+      ulonglong build_map= ((local_testflag & T_CREATE_MISSING_KEYS) ?
+                            (~share->state.key_map &
+                             mi_get_mask_all_keys_active(share->base.keys)) :
+                            share->state.key_map);
+      uint keys_to_build= my_count_bits(build_map);
+      if (THDVAR(thd, repair_threads)>1 && keys_to_build > 1)
       {
         char buf[40];
         /* TODO: respect myisam_repair_threads variable */
-        my_snprintf(buf, 40, "Repair with %d threads", my_count_bits(key_map));
+        my_snprintf(buf, 40, "Repair with %d threads", keys_to_build);
         thd_proc_info(thd, buf);
         /*
           The new file is created with the right stats, so we can skip
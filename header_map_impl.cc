@@ -33,6 +33,25 @@ void validateCapacity(uint64_t new_capacity) {
   ASSERT(new_capacity >= MinDynamicCapacity);
 }
 
+void setHeaderValue(HeaderString& header, uint64_t value) { header.setInteger(value); }
+
+void setHeaderValue(HeaderString& header, const std::string& value) {
+  header.setCopy(value.c_str(), value.size());
+}
+
+// Copies |key| and |value| into new HeaderStrings and hands them to |insert|, so both
+// HeaderMapImpl::addCopy() overloads share one copy path into insertByKey().
+template <class Value, class Insert>
+void addCopyByKey(const LowerCaseString& key, const Value& value, Insert insert) {
+  HeaderString new_key;
+  new_key.setCopy(key.get().c_str(), key.get().size());
+  HeaderString new_value;
+  setHeaderValue(new_value, value);
+  insert(std::move(new_key), std::move(new_value));
+  ASSERT(new_key.empty());   // NOLINT(bugprone-use-after-move)
+  ASSERT(new_value.empty()); // NOLINT(bugprone-use-after-move)
+}
+
 } // namespace
 
 HeaderString::HeaderString() : type_(Type::Inline) {
@@ -390,16 +409,9 @@ void HeaderMapImpl::insertByKey(HeaderString&& key, HeaderString&& value) {
 
 void HeaderMapImpl::addViaMove(HeaderString&& key, HeaderString&& value) {
   // If this is an inline header, we can't addViaMove, because we'll overwrite
-  // the existing value.
-  auto* entry = getExistingInline(key.getStringView());
-  if (entry != nullptr) {
-    const uint64_t added_size = appendToHeader(entry->value(), value.getStringView());
-    addSize(added_size);
-    key.clear();
-    value.clear();
-  } else {
-    insertByKey(std::move(key), std::move(value));
-  }
+  // the existing value. insertByKey() already appends to an existing inline header, so let it do
+  // the single static table lookup rather than probing the trie twice.
+  insertByKey(std::move(key), std::move(value));
 }
 
 void HeaderMapImpl::addReference(const LowerCaseString& key, const std::string& value) {
@@ -425,37 +437,16 @@ void HeaderMapImpl::addReferenceKey(const LowerCaseString& key, const std::strin
 }
 
 void HeaderMapImpl::addCopy(const LowerCaseString& key, uint64_t value) {
-  auto* entry = getExistingInline(key.get());
-  if (entry != nullptr) {
-    char buf[32];
-    StringUtil::itoa(buf, sizeof(buf), value);
-    const uint64_t added_size = appendToHeader(entry->value(), buf);
-    addSize(added_size);
-    return;
-  }
-  HeaderString new_key;
-  new_key.setCopy(key.get().c_str(), key.get().size());
-  HeaderString new_value;
-  new_value.setInteger(value);
-  insertByKey(std::move(new_key), std::move(new_value));
-  ASSERT(new_key.empty());   // NOLINT(bugprone-use-after-move)
-  ASSERT(new_value.empty()); // NOLINT(bugprone-use-after-move)
+  // insertByKey() does the single static table lookup, and appends to an existing inline header.
+  addCopyByKey(key, value, [this](HeaderString&& new_key, HeaderString&& new_value) {
+    insertByKey(std::move(new_key), std::move(new_value));
+  });
 }
 
 void HeaderMapImpl::addCopy(const LowerCaseString& key, const std::string& value) {
-  auto* entry = getExistingInline(key.get());
-  if (entry != nullptr) {
-    const uint64_t added_size = appendToHeader(entry->value(), value);
-    addSize(added_size);
-    return;
-  }
-  HeaderString new_key;
-  new_key.setCopy(key.get().c_str(), key.get().size());
-  HeaderString new_value;
-  new_value.setCopy(value.c_str(), value.size());
-  insertByKey(std::move(new_key), std::move(new_value));
-  ASSERT(new_key.empty());   // NOLINT(bugprone-use-after-move)
-  ASSERT(new_value.empty()); // NOLINT(bugprone-use-after-move)
+  addCopyByKey(key, value, [this](HeaderString&& new_key, HeaderString&& new_value) {
+    insertByKey(std::move(new_key), std::move(new_value));
+  });
 }
 
 void HeaderMapImpl::setReference(const LowerCaseString& key, const std::string& value) {
@@ -1,4 +1,8 @@
+#include "common/buffer/buffer_impl.h"
+#include "common/common/empty_string.h"
+#include "common/http/conn_manager_utility.h"
 #include "common/http/header_map_impl.h"
+#include "common/memory/stats.h"
 
 #include "benchmark/benchmark.h"
 
@@ -205,6 +209,175 @@ static void HeaderMapImplPopulate(benchmark::State& state) {
 }
 BENCHMARK(HeaderMapImplPopulate);
 
+/**
+ * Synthetic header sets modelled on a typical browser <-> origin request and response, used by
+ * the proxy workload benchmarks below. Keys are lowercase, as they are after codec decoding.
+ */
+static const std::vector<std::pair<std::string, std::string>>& representativeRequestHeaders() {
+  static const auto* headers = new std::vector<std::pair<std::string, std::string>>{
+      {":method", "GET"},
+      {":path", "/static/js/app.3f2b1c9e.js?v=20190123"},
+      {":authority", "www.example.com"},
+      {":scheme", "https"},
+      {"user-agent", "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+                     "Chrome/71.0.3578.98 Safari/537.36"},
+      {"accept", "*/*"},
+      {"accept-encoding", "gzip, deflate, br"},
+      {"accept-language", "en-US,en;q=0.9"},
+      {"cookie", "_ga=GA1.2.1234567890.1548216000; _gid=GA1.2.987654321.1548216000; "
+                 "session=ZXhhbXBsZS1zZXNzaW9uLXRva2Vu"},
+      {"referer", "https://www.example.com/products/index.html"},
+      {"if-none-match", "W/\"5c47e6a0-1f3a\""},
+      {"x-forwarded-for", "203.0.113.7"},
+      {"x-forwarded-proto", "https"},
+      {"x-request-id", "0b7a5b9e-4f7c-4d3b-9a2e-6f1c2d3e4f5a"},
+  };
+  return *headers;
+}
+
+static const std::vector<std::pair<std::string, std::string>>& representativeResponseHeaders() {
+  static const auto* headers = new std::vector<std::pair<std::string, std::string>>{
+      {":status", "200"},
+      {"cache-control", "public, max-age=31536000, immutable"},
+      {"content-encoding", "gzip"},
+      {"content-type", "application/javascript; charset=utf-8"},
+      {"content-length", "48213"},
+      {"date", "Wed, 23 Jan 2019 04:00:00 GMT"},
+      {"etag", "W/\"5c47e6a0-1f3a\""},
+      {"last-modified", "Tue, 22 Jan 2019 21:31:12 GMT"},
+      {"server", "nginx"},
+      {"vary", "Accept-Encoding"},
+      {"x-envoy-upstream-service-time", "4"},
+      {"strict-transport-security", "max-age=63072000; includeSubDomains"},
+      {"set-cookie", "_cookie1=12345678; path = /; secure"},
+      {"set-cookie", "_cookie2=12345678; path = /; secure"},
+  };
+  return *headers;
+}
+
+/**
+ * Populate a HeaderMap the way the codecs do: each key and value is copied out of the
+ * wire buffer into a HeaderString and then moved into the map.
+ */
+static void decodeHeaders(const std::vector<std::pair<std::string, std::string>>& wire,
+                          HeaderMapImpl& headers) {
+  for (const auto& key_value : wire) {
+    HeaderString key;
+    HeaderString value;
+    key.setCopy(key_value.first.data(), key_value.first.size());
+    value.setCopy(key_value.second.data(), key_value.second.size());
+    headers.addViaMove(std::move(key), std::move(value));
+  }
+}
+
+/**
+ * Serialize a HeaderMap into a buffer the way the HTTP/1 codec does in
+ * StreamEncoderImpl::encodeHeaders().
+ */
+static void encodeHeaders(const HeaderMap& headers, Buffer::Instance& output) {
+  headers.iterate(
+      [](const HeaderEntry& header, void* context) -> HeaderMap::Iterate {
+        auto* output = static_cast<Buffer::Instance*>(context);
+        const absl::string_view key = header.key().getStringView();
+        const absl::string_view value = header.value().getStringView();
+        output->add(key.data(), key.size());
+        output->add(": ", 2);
+        output->add(value.data(), value.size());
+        output->add("\r\n", 2);
+        return HeaderMap::Iterate::Continue;
+      },
+      &output);
+}
+
+/**
+ * Run one proxied request/response through the header hot path: decode both header
+ * blocks, apply the connection manager's response mutations and encode the response.
+ * @param peak_allocated if non-null, receives the heap in use once the response is encoded.
+ */
+static void proxyOneRequest(Buffer::Instance& output, uint64_t* peak_allocated) {
+  HeaderMapImpl request_headers;
+  HeaderMapImpl response_headers;
+  decodeHeaders(representativeRequestHeaders(), request_headers);
+  decodeHeaders(representativeResponseHeaders(), response_headers);
+  ConnectionManagerUtility::mutateResponseHeaders(response_headers, &request_headers,
+                                                  EMPTY_STRING);
+  encodeHeaders(response_headers, output);
+  if (peak_allocated != nullptr) {
+    *peak_allocated = Memory::Stats::totalCurrentlyAllocated();
+  }
+  output.drain(output.length());
+}
+
+/**
+ * Measure the cost of decoding a representative request header block into a HeaderMapImpl.
+ * The bytes_per_request counter reports the heap growth attributable to one decoded map.
+ */
+static void HeaderMapImplDecodeRepresentativeRequest(benchmark::State& state) {
+  const uint64_t baseline = Memory::Stats::totalCurrentlyAllocated();
+  uint64_t bytes_per_request;
+  {
+    HeaderMapImpl headers;
+    decodeHeaders(representativeRequestHeaders(), headers);
+    bytes_per_request = Memory::Stats::totalCurrentlyAllocated() - baseline;
+  }
+  for (auto _ : state) {
+    HeaderMapImpl headers;
+    decodeHeaders(representativeRequestHeaders(), headers);
+    benchmark::DoNotOptimize(headers.size());
+  }
+  state.counters["bytes_per_request"] = bytes_per_request;
+}
+BENCHMARK(HeaderMapImplDecodeRepresentativeRequest);
+
+/**
+ * Measure ConnectionManagerUtility::mutateResponseHeaders() against representative headers.
+ * @note The measured time for each iteration includes decoding the response headers,
+ *       since the mutation strips headers from the map.
+ */
+static void HeaderMapImplMutateRepresentativeResponse(benchmark::State& state) {
+  HeaderMapImpl request_headers;
+  decodeHeaders(representativeRequestHeaders(), request_headers);
+  for (auto _ : state) {
+    HeaderMapImpl response_headers;
+    decodeHeaders(representativeResponseHeaders(), response_headers);
+    ConnectionManagerUtility::mutateResponseHeaders(response_headers, &request_headers,
+                                                    EMPTY_STRING);
+    benchmark::DoNotOptimize(response_headers.size());
+  }
+}
+BENCHMARK(HeaderMapImplMutateRepresentativeResponse);
+
+/** Measure the speed of serializing representative response headers into a buffer. */
+static void HeaderMapImplEncodeRepresentativeResponse(benchmark::State& state) {
+  HeaderMapImpl headers;
+  decodeHeaders(representativeResponseHeaders(), headers);
+  Buffer::OwnedImpl output;
+  for (auto _ : state) {
+    encodeHeaders(headers, output);
+    output.drain(output.length());
+  }
+  benchmark::DoNotOptimize(output.length());
+}
+BENCHMARK(HeaderMapImplEncodeRepresentativeResponse);
+
+/**
+ * Measure the full request/response header path of a proxied request: decode, response
+ * mutation and encode. The bytes_per_request counter reports the heap held at the peak
+ * of one request, so regressions in per-request allocation show up alongside time.
+ */
+static void HeaderMapImplProxyRepresentativeRequest(benchmark::State& state) {
+  Buffer::OwnedImpl output;
+  const uint64_t baseline = Memory::Stats::totalCurrentlyAllocated();
+  uint64_t peak_allocated = baseline;
+  proxyOneRequest(output, &peak_allocated);
+  for (auto _ : state) {
+    proxyOneRequest(output, nullptr);
+  }
+  benchmark::DoNotOptimize(output.length());
+  state.counters["bytes_per_request"] = peak_allocated - baseline;
+}
+BENCHMARK(HeaderMapImplProxyRepresentativeRequest);
+
 } // namespace Http
 } // namespace Envoy
 
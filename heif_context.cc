@@ -988,8 +988,9 @@ Error HeifContext::decode_image(heif_item_id ID,
   // channel, then the alpha images should be associated with their respective tiles.
   // However, the tile images are not part of the m_all_images list.
   // Fix this, when we have a test image available.
-  if (m_all_images.find(ID) != m_all_images.end()) {
-    const auto imginfo = m_all_images.find(ID)->second;
+  auto image_iter = m_all_images.find(ID);
+  if (image_iter != m_all_images.end()) {
+    const auto& imginfo = image_iter->second;
 
     std::shared_ptr<Image> alpha_image = imginfo->get_alpha_channel();
     if (alpha_image) {
@@ -4,6 +4,7 @@
 
 #include "net/dns/host_cache.h"
 
+#include <iterator>
 #include <utility>
 
 #include "base/logging.h"
@@ -421,12 +422,17 @@ std::unique_ptr<HostCache> HostCache::CreateDefaultCache() {
 void HostCache::EvictOneEntry(base::TimeTicks now) {
   DCHECK_LT(0u, entries_.size());
 
+  // Remember whether the current candidate is stale so each entry's staleness
+  // is computed at most once per scan.
   auto oldest_it = entries_.begin();
-  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
-    if ((it->second.expires() < oldest_it->second.expires()) &&
-        (it->second.IsStale(now, network_changes_) ||
-         !oldest_it->second.IsStale(now, network_changes_))) {
+  bool oldest_is_stale = oldest_it->second.IsStale(now, network_changes_);
+  for (auto it = std::next(entries_.begin()); it != entries_.end(); ++it) {
+    if (it->second.expires() >= oldest_it->second.expires())
+      continue;
+    bool is_stale = it->second.IsStale(now, network_changes_);
+    if (is_stale || !oldest_is_stale) {
       oldest_it = it;
+      oldest_is_stale = is_stale;
     }
   }
 
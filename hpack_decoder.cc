@@ -83,9 +83,13 @@ bool HpackDecoder::HandleHeaderRepresentation(StringPiece name,
       cookie_value_.insert(cookie_value_.end(), value.begin(), value.end());
     }
   } else {
+    // Insert an empty value and fill it in place, so that a repeated header
+    // name costs no temporary copy of the (possibly large) value.
     InsertResult result = decoded_block_.insert(
-        std::make_pair(name.as_string(), value.as_string()));
-    if (!result.second) {
+        std::make_pair(name.as_string(), string()));
+    if (result.second) {
+      result.first->second.assign(value.data(), value.size());
+    } else {
       result.first->second.push_back('\0');
       result.first->second.insert(result.first->second.end(),
                                   value.begin(),
@@ -1,6 +1,10 @@
 #include "test/integration/http2_integration_test.h"
 
 #include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iostream>
 #include <string>
 
 #include "common/buffer/buffer_impl.h"
@@ -1081,6 +1085,78 @@ TEST_P(Http2IntegrationTest, SimultaneousRequestWithBufferLimits) {
   simultaneousRequest(1024 * 32, 1024 * 16);
 }
 
+namespace {
+
+// The speed tests below are disabled by default. Run them with
+// --gtest_also_run_disabled_tests --gtest_filter='*SpeedTest*' to compare codec and header map
+// changes on realistic round-trips.
+constexpr uint32_t kSpeedTestIterations = 1000;
+
+// Runs |round_trip| |iterations| times and prints requests/s and CPU time per request. CPU time
+// is for the whole process, so it also covers the codec client and the fake upstream. Stops
+// without printing once a round trip hits a fatal failure, since ASSERT_* in |round_trip| only
+// returns from the lambda.
+void runSpeedTest(const std::string& name, uint32_t iterations,
+                  const std::function<void()>& round_trip) {
+  const auto wall_start = std::chrono::steady_clock::now();
+  const std::clock_t cpu_start = std::clock();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    round_trip();
+    if (::testing::Test::HasFatalFailure()) {
+      return;
+    }
+  }
+  const std::clock_t cpu_ticks = std::clock() - cpu_start;
+  const std::chrono::duration<double> wall_time = std::chrono::steady_clock::now() - wall_start;
+
+  const double cpu_us_per_request = 1e6 * cpu_ticks / CLOCKS_PER_SEC / iterations;
+  std::cout << name << ": " << iterations << " requests, " << iterations / wall_time.count()
+            << " requests/s, " << cpu_us_per_request << " us CPU/request" << std::endl;
+}
+
+} // namespace
+
+TEST_P(Http2IntegrationTest, DISABLED_SpeedTestLargeHeaders) {
+  initialize();
+  codec_client_ = makeHttpConnection(lookupPort("http"));
+  Http::TestHeaderMapImpl request_headers{
+      {":method", "GET"},     {":path", "/test/long/url"}, {":scheme", "http"},
+      {":authority", "host"}, {"x-lyft-user-id", "123"},   {"x-forwarded-for", "10.0.0.1"}};
+  request_headers.addCopy("big", std::string(4096, 'a'));
+
+  runSpeedTest("LargeHeaders", kSpeedTestIterations, [&]() {
+    auto response =
+        sendRequestAndWaitForResponse(request_headers, 0, default_response_headers_, 0);
+    ASSERT_TRUE(response->complete());
+  });
+  cleanupUpstreamAndDownstream();
+}
+
+TEST_P(Http2IntegrationTest, DISABLED_SpeedTestManySmallStreams) {
+  initialize();
+  codec_client_ = makeHttpConnection(lookupPort("http"));
+
+  runSpeedTest("ManySmallStreams", kSpeedTestIterations, [&]() {
+    auto response =
+        sendRequestAndWaitForResponse(default_request_headers_, 64, default_response_headers_, 64);
+    ASSERT_TRUE(response->complete());
+  });
+  cleanupUpstreamAndDownstream();
+}
+
+TEST_P(Http2IntegrationTest, DISABLED_SpeedTestGiantBodyWithFlowControl) {
+  config_helper_.setBufferLimits(1024, 1024); // Set buffer limits upstream and downstream.
+  initialize();
+  codec_client_ = makeHttpConnection(lookupPort("http"));
+
+  runSpeedTest("GiantBodyWithFlowControl", kSpeedTestIterations / 10, [&]() {
+    auto response = sendRequestAndWaitForResponse(default_request_headers_, 1024 * 1024,
+                                                  default_response_headers_, 1024 * 1024);
+    ASSERT_TRUE(response->complete());
+  });
+  cleanupUpstreamAndDownstream();
+}
+
 // Test downstream connection delayed close processing.
 TEST_P(Http2IntegrationTest, DelayedCloseAfterBadFrame) {
   initialize();
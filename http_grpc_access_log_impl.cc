@@ -1,16 +1,50 @@
 #include "extensions/access_loggers/grpc/http_grpc_access_log_impl.h"
 
 #include "common/common/assert.h"
+#include "common/common/macros.h"
 #include "common/network/utility.h"
 #include "common/stream_info/utility.h"
 
 #include "extensions/access_loggers/grpc/grpc_access_log_utils.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace AccessLoggers {
 namespace HttpGrpc {
 
+namespace {
+
+using RequestMethodMap =
+    absl::flat_hash_map<std::string, envoy::api::v2::core::RequestMethod>;
+
+RequestMethodMap buildRequestMethodMap() {
+  RequestMethodMap methods;
+  const auto* descriptor = envoy::api::v2::core::RequestMethod_descriptor();
+  for (int i = 0; i < descriptor->value_count(); ++i) {
+    const auto* value = descriptor->value(i);
+    methods.emplace(value->name(),
+                    static_cast<envoy::api::v2::core::RequestMethod>(value->number()));
+  }
+  return methods;
+}
+
+const RequestMethodMap& requestMethodMap() {
+  CONSTRUCT_ON_FIRST_USE(RequestMethodMap, buildRequestMethodMap());
+}
+
+// emitLog() runs for every request, so resolve the method through a prebuilt table instead of
+// copying the header into a std::string for RequestMethod_Parse().
+envoy::api::v2::core::RequestMethod requestMethod(absl::string_view method) {
+  const auto& methods = requestMethodMap();
+  const auto it = methods.find(method);
+  return it != methods.end() ? it->second
+                             : envoy::api::v2::core::RequestMethod::METHOD_UNSPECIFIED;
+}
+
+} // namespace
+
 HttpGrpcAccessLog::ThreadLocalLogger::ThreadLocalLogger(
     GrpcCommon::GrpcAccessLoggerSharedPtr logger)
     : logger_(std::move(logger)) {}
@@ -98,11 +132,8 @@ void HttpGrpcAccessLog::emitLog(const Http::HeaderMap& request_headers,
   request_properties->set_request_headers_bytes(request_headers.byteSize().value());
   request_properties->set_request_body_bytes(stream_info.bytesReceived());
   if (request_headers.Method() != nullptr) {
-    envoy::api::v2::core::RequestMethod method =
-        envoy::api::v2::core::RequestMethod::METHOD_UNSPECIFIED;
-    envoy::api::v2::core::RequestMethod_Parse(
-        std::string(request_headers.Method()->value().getStringView()), &method);
-    request_properties->set_request_method(method);
+    request_properties->set_request_method(
+        requestMethod(request_headers.Method()->value().getStringView()));
   }
   if (!request_headers_to_log_.empty()) {
     auto* logged_headers = request_properties->mutable_request_headers();
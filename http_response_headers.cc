@@ -267,7 +267,9 @@ void HttpResponseHeaders::Update(const HttpResponseHeaders& new_headers) {
 
 void HttpResponseHeaders::MergeWithHeaders(const std::string& raw_headers,
                                            const HeaderSet& headers_to_remove) {
-  std::string new_raw_headers(raw_headers);
+  std::string new_raw_headers;
+  new_raw_headers.reserve(raw_headers.size() + raw_headers_.size() + 1);
+  new_raw_headers.append(raw_headers);
   for (size_t i = 0; i < parsed_.size(); ++i) {
     DCHECK(!parsed_[i].is_continuation());
 
@@ -276,9 +278,13 @@ void HttpResponseHeaders::MergeWithHeaders(const std::string& raw_headers,
     while (++k < parsed_.size() && parsed_[k].is_continuation()) {}
     --k;
 
-    std::string name(parsed_[i].name_begin, parsed_[i].name_end);
-    StringToLowerASCII(&name);
-    if (headers_to_remove.find(name) == headers_to_remove.end()) {
+    bool preserve = headers_to_remove.empty();
+    if (!preserve) {
+      std::string name(parsed_[i].name_begin, parsed_[i].name_end);
+      StringToLowerASCII(&name);
+      preserve = headers_to_remove.find(name) == headers_to_remove.end();
+    }
+    if (preserve) {
       // It's ok to preserve this header in the final result.
       new_raw_headers.append(parsed_[i].name_begin, parsed_[k].value_end);
       new_raw_headers.push_back('\0');
@@ -295,6 +301,10 @@ void HttpResponseHeaders::MergeWithHeaders(const std::string& raw_headers,
 }
 
 void HttpResponseHeaders::RemoveHeader(const std::string& name) {
+  // Nothing to rebuild if the header isn't present.
+  if (!HasHeader(name))
+    return;
+
   // Copy up to the null byte.  This just copies the status line.
   std::string new_raw_headers(raw_headers_.c_str());
   new_raw_headers.push_back('\0');
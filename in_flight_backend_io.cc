@@ -54,6 +54,9 @@ BackendIO::BackendIO(InFlightIO* controller, BackendImpl* backend,
 
 // Runs on the background thread.
 void BackendIO::ExecuteOperation() {
+  // Time spent waiting behind other operations for the cache thread.
+  CACHE_UMA(TIMES, "BackendIOQueueTime", 0, ElapsedTime());
+
   if (IsEntryOperation())
     return ExecuteEntryOperation();
 
@@ -5,6 +5,7 @@
 #include "content/browser/indexed_db/indexed_db_cursor.h"
 
 #include <stddef.h>
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -19,6 +20,10 @@
 
 namespace content {
 namespace {
+
+// Upper bound on the number of records reserved ahead of a prefetch.
+const size_t kMaxPrefetchReserve = 100;
+
 // This should never be script visible: the cursor should either be closed when
 // it hits the end of the range (and script throws an error before the call
 // could be made), if the transaction has finished (ditto), or if there's an
@@ -185,6 +190,14 @@ leveldb::Status IndexedDBCursor::CursorPrefetchIterationOperation(
   std::vector<IndexedDBKey> found_keys;
   std::vector<IndexedDBKey> found_primary_keys;
   std::vector<IndexedDBValue> found_values;
+  // Bound the up-front reservation so that an oversized request from the
+  // renderer cannot force a large allocation before any record is read.
+  const size_t reserve_count =
+      std::min(static_cast<size_t>(std::max(number_to_fetch, 0)),
+               kMaxPrefetchReserve);
+  found_keys.reserve(reserve_count);
+  found_primary_keys.reserve(reserve_count);
+  found_values.reserve(reserve_count);
 
   saved_cursor_.reset();
   // TODO(cmumford): Use IPC::Channel::kMaximumMessageSize
@@ -219,13 +232,14 @@ leveldb::Status IndexedDBCursor::CursorPrefetchIterationOperation(
 
     switch (cursor_type_) {
       case indexed_db::CURSOR_KEY_ONLY:
-        found_values.push_back(IndexedDBValue());
+        found_values.emplace_back();
         break;
       case indexed_db::CURSOR_KEY_AND_VALUE: {
-        IndexedDBValue value;
-        value.swap(*cursor_->value());
-        size_estimate += value.SizeEstimate();
-        found_values.push_back(value);
+        // Swap the value straight into its slot rather than copying the
+        // (potentially large) bits and blob info a second time.
+        found_values.emplace_back();
+        found_values.back().swap(*cursor_->value());
+        size_estimate += found_values.back().SizeEstimate();
         break;
       }
       default:
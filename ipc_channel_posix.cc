@@ -545,7 +545,8 @@ bool Channel::ChannelImpl::ProcessIncomingMessages() {
     // Process messages from input buffer.
     const char *p;
     const char *end;
-    if (input_overflow_buf_.empty()) {
+    const bool reading_overflow_buf = !input_overflow_buf_.empty();
+    if (!reading_overflow_buf) {
       p = input_buf_;
       end = p + bytes_read;
     } else {
@@ -710,7 +711,14 @@ bool Channel::ChannelImpl::ProcessIncomingMessages() {
       fds = &input_overflow_fds_[0];
       num_fds = input_overflow_fds_.size();
     }
-    input_overflow_buf_.assign(p, end - p);
+    if (reading_overflow_buf) {
+      // Drop only the consumed prefix. While a large message trickles in,
+      // nothing is consumed and the buffer is left alone rather than being
+      // copied onto itself after every read.
+      input_overflow_buf_.erase(0, p - input_overflow_buf_.data());
+    } else {
+      input_overflow_buf_.assign(p, end - p);
+    }
     input_overflow_fds_ = std::vector<int>(&fds[fds_i], &fds[num_fds]);
 
     // When the input data buffer is empty, the overflow fds should be too. If
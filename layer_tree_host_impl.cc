@@ -159,6 +159,18 @@ void RecordCompositorSlowScrollMetric(InputHandler::ScrollInputType type,
 DEFINE_SCOPED_UMA_HISTOGRAM_TIMER(PendingTreeDurationHistogramTimer,
                                   "Scheduling.%s.PendingTreeDuration");
 
+// Per-phase frame timers. Together they break an impl frame down into its
+// animate, tile preparation, draw preparation and draw phases, so a phase that
+// blows the frame budget shows up in UMA without needing a trace.
+DEFINE_SCOPED_UMA_HISTOGRAM_TIMER(AnimateDurationHistogramTimer,
+                                  "Scheduling.%s.AnimateDuration");
+DEFINE_SCOPED_UMA_HISTOGRAM_TIMER(PrepareTilesDurationHistogramTimer,
+                                  "Scheduling.%s.PrepareTilesDuration");
+DEFINE_SCOPED_UMA_HISTOGRAM_TIMER(PrepareToDrawDurationHistogramTimer,
+                                  "Scheduling.%s.PrepareToDrawDuration");
+DEFINE_SCOPED_UMA_HISTOGRAM_TIMER(DrawLayersDurationHistogramTimer,
+                                  "Scheduling.%s.DrawLayersDuration");
+
 LayerTreeHostImpl::FrameData::FrameData()
     : render_surface_layer_list(nullptr),
       has_no_damage(false),
@@ -435,6 +447,7 @@ void LayerTreeHostImpl::AnimatePendingTreeAfterCommit() {
 }
 
 void LayerTreeHostImpl::Animate() {
+  AnimateDurationHistogramTimer timer;
   AnimateInternal(true);
 }
 
@@ -499,6 +512,7 @@ bool LayerTreeHostImpl::PrepareTiles() {
   if (!tile_priorities_dirty_)
     return false;
 
+  PrepareTilesDurationHistogramTimer timer;
   client_->WillPrepareTiles();
   bool did_prepare_tiles = tile_manager_.PrepareTiles(global_tile_state_);
   if (did_prepare_tiles)
@@ -1075,6 +1089,7 @@ void LayerTreeHostImpl::InvalidateContentOnImplSide() {
 DrawResult LayerTreeHostImpl::PrepareToDraw(FrameData* frame) {
   TRACE_EVENT1("cc", "LayerTreeHostImpl::PrepareToDraw", "SourceFrameNumber",
                active_tree_->source_frame_number());
+  PrepareToDrawDurationHistogramTimer timer;
   if (input_handler_client_)
     input_handler_client_->ReconcileElasticOverscrollAndRootScroll();
 
@@ -1629,6 +1644,7 @@ bool LayerTreeHostImpl::DrawLayers(FrameData* frame) {
   DCHECK_EQ(frame->has_no_damage, frame->render_passes.empty());
 
   TRACE_EVENT0("cc,benchmark", "LayerTreeHostImpl::DrawLayers");
+  DrawLayersDurationHistogramTimer timer;
 
   ResetRequiresHighResToDraw();
 
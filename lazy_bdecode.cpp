@@ -40,6 +40,9 @@ namespace
 	const int lazy_entry_grow_factor = 150; // percent
 	const int lazy_entry_dict_init = 5;
 	const int lazy_entry_list_init = 5;
+	// initial capacity of the parse stack. Typical .torrent and resume
+	// files nest only a handful of levels, so this avoids regrowing it.
+	const int lazy_entry_stack_init = 32;
 }
 
 namespace libtorrent
@@ -119,6 +122,7 @@ namespace libtorrent
 		if (start == end) return 0;
 
 		std::vector<lazy_entry*> stack;
+		stack.reserve(lazy_entry_stack_init);
 
 		stack.push_back(&ret);
 		while (start <= end)
@@ -307,24 +311,6 @@ namespace libtorrent
 		m_len = start - m_begin + length;
 	}
 
-	namespace
-	{
-		// str1 is null-terminated
-		// str2 is not, str2 is len2 chars
-		bool string_equal(char const* str1, char const* str2, int len2)
-		{
-			while (len2 > 0)
-			{
-				if (*str1 != *str2) return false;
-				if (*str1 == 0) return false;
-				++str1;
-				++str2;
-				--len2;
-			}
-			return *str1 == 0;
-		}
-	}
-
 	std::pair<std::string, lazy_entry const*> lazy_entry::dict_at(int i) const
 	{
 		TORRENT_ASSERT(m_type == dict_t);
@@ -392,10 +378,14 @@ namespace libtorrent
 	lazy_entry* lazy_entry::dict_find(char const* name)
 	{
 		TORRENT_ASSERT(m_type == dict_t);
+		// compare lengths first, most keys can be rejected without
+		// looking at their characters
+		int const name_len = int(std::strlen(name));
 		for (int i = 0; i < int(m_size); ++i)
 		{
 			lazy_dict_entry& e = m_data.dict[i];
-			if (string_equal(name, e.name, e.val.m_begin - e.name))
+			if (name_len != e.val.m_begin - e.name) continue;
+			if (std::memcmp(name, e.name, name_len) == 0)
 				return &e.val;
 		}
 		return 0;
@@ -2442,30 +2442,43 @@ void LibRaw::convert_to_rgb_loop(float out_cam[3][4])
 	int row,col,c;
 	float out[3];
 	ushort *img;
+	// Loop invariants: kept in locals so the per-pixel loop doesn't re-test
+	// raw_color or reload colors through imgdata for every pixel.
+	const int colors = imgdata.idata.colors;
+	const int raw_color = libraw_internal_data.internal_output_params.raw_color;
 	memset(libraw_internal_data.output_data.histogram,0,sizeof(int)*LIBRAW_HISTOGRAM_SIZE*4);
+	if (raw_color) {
+		for (img=imgdata.image[0], row=0; row < S.height; row++)
+			for (col=0; col < S.width; col++, img+=4)
+				for(c=0; c< colors; c++) libraw_internal_data.output_data.histogram[c][img[c] >> 3]++;
+		return;
+	}
 	for (img=imgdata.image[0], row=0; row < S.height; row++)
 		for (col=0; col < S.width; col++, img+=4) {
-			if (!libraw_internal_data.internal_output_params.raw_color) {
-				out[0] = out[1] = out[2] = 0;
-				for(c=0; c< imgdata.idata.colors; c++) {
-					out[0] += out_cam[0][c] * img[c];
-					out[1] += out_cam[1][c] * img[c];
-					out[2] += out_cam[2][c] * img[c];
-				}
-				for(c=0;c<3;c++) img[c] = CLIP((int) out[c]);
+			out[0] = out[1] = out[2] = 0;
+			for(c=0; c< colors; c++) {
+				out[0] += out_cam[0][c] * img[c];
+				out[1] += out_cam[1][c] * img[c];
+				out[2] += out_cam[2][c] * img[c];
 			}
-			for(c=0; c< imgdata.idata.colors; c++) libraw_internal_data.output_data.histogram[c][img[c] >> 3]++;
+			for(c=0;c<3;c++) img[c] = CLIP((int) out[c]);
+			for(c=0; c< colors; c++) libraw_internal_data.output_data.histogram[c][img[c] >> 3]++;
 		}
 
 }
 
 void LibRaw::scale_colors_loop(float scale_mul[4])
 {
-  unsigned size = S.iheight*S.iwidth;
+  int size = S.iheight*S.iwidth;
   
+  // Every value is scaled independently, so both loops split across
+  // threads without any shared state.
   if(C.cblack[0]||C.cblack[1]||C.cblack[2]||C.cblack[3])
     {
-      for (unsigned i=0; i < size*4; i++) 
+#if defined(LIBRAW_USE_OPENMP)
+#pragma omp parallel for default(shared)
+#endif
+      for (int i=0; i < size*4; i++) 
         {
           int val = imgdata.image[0][i];
           if (!val) continue;
@@ -2476,7 +2489,10 @@ void LibRaw::scale_colors_loop(float scale_mul[4])
     }
   else // BL is zero
     {
-      for (unsigned i=0; i < size*4; i++) 
+#if defined(LIBRAW_USE_OPENMP)
+#pragma omp parallel for default(shared)
+#endif
+      for (int i=0; i < size*4; i++) 
         {
           int val = imgdata.image[0][i];
           val *= scale_mul[i & 3];
@@ -529,9 +529,12 @@ void MediaRecorderHandler::WriteData(base::StringPiece data) {
 bool MediaRecorderHandler::UpdateTracksAndCheckIfChanged() {
   DCHECK(main_render_thread_checker_.CalledOnValidThread());
 
-  blink::WebVector<blink::WebMediaStreamTrack> video_tracks, audio_tracks;
-  video_tracks = media_stream_.VideoTracks();
-  audio_tracks = media_stream_.AudioTracks();
+  // This runs for every encoded audio and video chunk, so avoid copying the
+  // track vectors: build them in place and swap them in when changed.
+  blink::WebVector<blink::WebMediaStreamTrack> video_tracks =
+      media_stream_.VideoTracks();
+  blink::WebVector<blink::WebMediaStreamTrack> audio_tracks =
+      media_stream_.AudioTracks();
 
   bool video_tracks_changed = video_tracks_.size() != video_tracks.size();
   bool audio_tracks_changed = audio_tracks_.size() != audio_tracks.size();
@@ -554,9 +557,9 @@ bool MediaRecorderHandler::UpdateTracksAndCheckIfChanged() {
   }
 
   if (video_tracks_changed)
-    video_tracks_ = video_tracks;
+    video_tracks_.Swap(video_tracks);
   if (audio_tracks_changed)
-    audio_tracks_ = audio_tracks;
+    audio_tracks_.Swap(audio_tracks);
 
   return video_tracks_changed || audio_tracks_changed;
 }
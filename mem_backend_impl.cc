@@ -320,6 +320,15 @@ size_t MemBackendImpl::DumpMemoryStats(
   dump->AddScalar("mem_backend_max_size",
                   base::trace_event::MemoryAllocatorDump::kUnitsBytes,
                   max_size_);
+  dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameObjectCount,
+                  base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+                  entries_.size());
+  // Memory held beyond the bytes entries actually store: per-entry
+  // bookkeeping plus unused capacity of the stream buffers.
+  size_t stored_size = static_cast<size_t>(std::max(0, current_size_));
+  dump->AddScalar("mem_backend_overhead",
+                  base::trace_event::MemoryAllocatorDump::kUnitsBytes,
+                  size > stored_size ? size - stored_size : 0);
   return size;
 }
 
@@ -316,16 +316,12 @@ static bool MatchMagicNumber(const char* content,
   // Keep kBytesRequiredForMagic honest.
   DCHECK_LE(len, kBytesRequiredForMagic);
 
-  // To compare with magic strings, we need to compute strlen(content), but
-  // content might not actually have a null terminator.  In that case, we
-  // pretend the length is content_size.
-  const char* end = static_cast<const char*>(memchr(content, '\0', size));
-  const size_t content_strlen =
-      (end != NULL) ? static_cast<size_t>(end - content) : size;
-
   bool match = false;
   if (magic_entry.is_string) {
-    if (content_strlen >= len) {
+    // Magic strings only match if strlen(content) >= len, but content might
+    // not actually have a null terminator. Only the first |len| bytes decide
+    // that, so there is no need to scan the rest of the buffer.
+    if (size >= len && !memchr(content, '\0', len)) {
       // Do a case-insensitive prefix comparison.
       DCHECK_EQ(strlen(magic_entry.magic), len);
       match = base::EqualsCaseInsensitiveASCII(magic_entry.magic,
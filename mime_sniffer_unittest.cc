@@ -306,6 +306,17 @@ TEST(MimeSnifferTest, FlashTest) {
   TestArray(tests, arraysize(tests));
 }
 
+TEST(MimeSnifferTest, MagicStringWithEmbeddedNull) {
+  // A null byte after the magic string does not prevent a match.
+  EXPECT_EQ("text/html",
+            SniffMimeType(std::string("<html>\0\x01", 8),
+                          "http://www.example.com/", std::string()));
+  // A null byte inside the magic string does.
+  EXPECT_EQ("application/octet-stream",
+            SniffMimeType(std::string("<ht\0ml>", 7),
+                          "http://www.example.com/", std::string()));
+}
+
 TEST(MimeSnifferTest, XMLTest) {
   // An easy feed to identify.
   EXPECT_EQ("application/atom+xml",
@@ -73,6 +73,12 @@ T clamp(T value, T min, T max) {
   return std::max(std::min(value, max), min);
 }
 
+// Only playback rates greater than 1.0 in magnitude scale the buffer window;
+// the result is clamped to prevent overflow.
+static double BufferingPlaybackRate(double playback_rate) {
+  return clamp(playback_rate, 1.0, kMaxPlaybackRate);
+}
+
 class MultibufferDataSource::ReadOperation {
  public:
   ReadOperation(int64_t position,
@@ -296,9 +302,16 @@ void MultibufferDataSource::MediaPlaybackRateChanged(double playback_rate) {
   if (playback_rate < 0.0)
     return;
 
+  // Pausing, resuming and slow playback all buffer the same way, so skip
+  // recomputing (and re-pinning) the buffer window unless the rate used for
+  // buffering actually changes.
+  const bool buffering_rate_changed =
+      BufferingPlaybackRate(playback_rate) !=
+      BufferingPlaybackRate(playback_rate_);
   playback_rate_ = playback_rate;
   cancel_on_defer_ = false;
-  UpdateBufferSizes();
+  if (buffering_rate_changed)
+    UpdateBufferSizes();
 }
 
 void MultibufferDataSource::MediaIsPlaying() {
@@ -701,12 +714,7 @@ void MultibufferDataSource::UpdateBufferSizes() {
   if (bitrate == 0)
     bitrate = kDefaultBitrate;
 
-  // Only scale the buffer window for playback rates greater than 1.0 in
-  // magnitude and clamp to prevent overflow.
-  double playback_rate = playback_rate_;
-
-  playback_rate = std::max(playback_rate, 1.0);
-  playback_rate = std::min(playback_rate, kMaxPlaybackRate);
+  double playback_rate = BufferingPlaybackRate(playback_rate_);
 
   int64_t bytes_per_second = (bitrate / 8.0) * playback_rate;
 
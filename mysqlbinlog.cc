@@ -65,6 +65,12 @@ using std::max;
 #define PROBE_HEADER_LEN	(EVENT_LEN_OFFSET+4)
 #define INTVAR_DYNAMIC_INIT	16
 #define INTVAR_DYNAMIC_INCR	1
+/*
+  Read cache used for local binlogs and stdin. Row events are often
+  much larger than the default record cache, so a bigger buffer keeps
+  read_log_event() from issuing several reads per event.
+*/
+#define LOCAL_LOG_READ_CACHE_SIZE (IO_SIZE * 256)
 
 /*
   The character set used should be equal to the one used in mysqld.cc for
@@ -2637,8 +2643,8 @@ static Exit_status dump_local_log_entries(PRINT_EVENT_INFO *print_event_info,
     /* read from normal file */
     if ((fd = my_open(logname, O_RDONLY | O_BINARY, MYF(MY_WME))) < 0)
       return ERROR_STOP;
-    if (init_io_cache(file, fd, 0, READ_CACHE, start_position_mot, 0,
-		      MYF(MY_WME | MY_NABP)))
+    if (init_io_cache(file, fd, LOCAL_LOG_READ_CACHE_SIZE, READ_CACHE,
+                      start_position_mot, 0, MYF(MY_WME | MY_NABP)))
     {
       my_close(fd, MYF(MY_WME));
       return ERROR_STOP;
@@ -2664,8 +2670,9 @@ static Exit_status dump_local_log_entries(PRINT_EVENT_INFO *print_event_info,
       return ERROR_STOP;
     }
 #endif 
-    if (init_io_cache(file, my_fileno(stdin), 0, READ_CACHE, (my_off_t) 0,
-		      0, MYF(MY_WME | MY_NABP | MY_DONT_CHECK_FILESIZE)))
+    if (init_io_cache(file, my_fileno(stdin), LOCAL_LOG_READ_CACHE_SIZE,
+                      READ_CACHE, (my_off_t) 0, 0,
+                      MYF(MY_WME | MY_NABP | MY_DONT_CHECK_FILESIZE)))
     {
       error("Failed to init IO cache.");
       return ERROR_STOP;
@@ -2675,7 +2682,7 @@ static Exit_status dump_local_log_entries(PRINT_EVENT_INFO *print_event_info,
     if (start_position)
     {
       /* skip 'start_position' characters from stdin */
-      uchar buff[IO_SIZE];
+      uchar buff[IO_SIZE * 16];
       my_off_t length,tmp;
       for (length= start_position_mot ; length > 0 ; length-=tmp)
       {
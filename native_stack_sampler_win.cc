@@ -158,9 +158,23 @@ int RecordStack(CONTEXT* context, int max_stack_size,
 // incremented and should be freed with FreeModuleHandles. See note in
 // SuspendThreadAndRecordStack for why |addresses| and |module_handles| are
 // arrays.
+//
+// Runs of consecutive frames in the same module are common, so a frame that
+// lies within the image of the previous frame's module reuses that handle
+// instead of taking the loader lock again. Only the first handle of each such
+// run holds a reference.
 void FindModuleHandlesForAddresses(const void* const addresses[],
                                    HMODULE module_handles[], int stack_depth) {
+  uintptr_t previous_module_start = 0;
+  uintptr_t previous_module_end = 0;
   for (int i = 0; i < stack_depth; ++i) {
+    const uintptr_t address = reinterpret_cast<uintptr_t>(addresses[i]);
+    if (i > 0 && module_handles[i - 1] && address >= previous_module_start &&
+        address < previous_module_end) {
+      module_handles[i] = module_handles[i - 1];
+      continue;
+    }
+
     HMODULE module_handle = NULL;
     if (GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS,
                           reinterpret_cast<LPCTSTR>(addresses[i]),
@@ -169,15 +183,22 @@ void FindModuleHandlesForAddresses(const void* const addresses[],
       // use it directly as an address.
       DCHECK_LE(reinterpret_cast<const void*>(module_handle), addresses[i]);
       module_handles[i] = module_handle;
+      const win::PEImage image(module_handle);
+      previous_module_start = reinterpret_cast<uintptr_t>(module_handle);
+      previous_module_end = previous_module_start +
+                            image.GetNTHeaders()->OptionalHeader.SizeOfImage;
     }
   }
 }
 
-// Frees the modules handles returned by FindModuleHandlesForAddresses. See note
-// in SuspendThreadAndRecordStack for why |module_handles| is an array.
+// Frees the modules handles returned by FindModuleHandlesForAddresses. A handle
+// repeated from the previous frame holds no reference of its own. See note in
+// SuspendThreadAndRecordStack for why |module_handles| is an array.
 void FreeModuleHandles(int stack_depth, HMODULE module_handles[]) {
   for (int i = 0; i < stack_depth; ++i) {
-    if (module_handles[i])
+    const bool repeats_previous =
+        i > 0 && module_handles[i] == module_handles[i - 1];
+    if (module_handles[i] && !repeats_previous)
       ::FreeLibrary(module_handles[i]);
   }
 }
@@ -89,32 +89,43 @@ scoped_refptr<NGLayoutResult> NGFlexLayoutAlgorithm::Layout() {
         is_horizontal_flow ? physical_border_padding.HorizontalSum()
                            : physical_border_padding.VerticalSum();
 
-    // ComputeMinMaxSize will layout the child if it has an orthogonal writing
-    // mode. MinMaxSize will be in the container's inline direction.
-    MinMaxSizeInput zero_input;
-    MinMaxSize min_max_sizes_border_box = child.ComputeMinMaxSize(
-        ConstraintSpace().GetWritingMode(), zero_input, &child_space);
-    // TODO(dgrogan): Don't layout every time, just when you need to.
-    scoped_refptr<NGLayoutResult> layout_result =
-        child.Layout(child_space, nullptr /*break token*/);
-    NGFragment fragment_in_child_writing_mode(
-        child_style.GetWritingMode(), *layout_result->PhysicalFragment());
+    // Only compute what the flex base size needs: the min/max content sizes
+    // when the main axis is the child's inline axis, and a layout for its
+    // block size otherwise. Every item is laid out again once its flexed size
+    // is known, so a layout here is wasted work in the inline case.
+    bool main_axis_is_inline_axis = MainAxisIsInlineAxis(child);
+    MinMaxSize min_max_sizes_border_box;
+    LayoutUnit child_block_size;
+    if (main_axis_is_inline_axis) {
+      // ComputeMinMaxSize will layout the child if it has an orthogonal
+      // writing mode. MinMaxSize will be in the container's inline direction.
+      MinMaxSizeInput zero_input;
+      min_max_sizes_border_box = child.ComputeMinMaxSize(
+          ConstraintSpace().GetWritingMode(), zero_input, &child_space);
+    } else {
+      scoped_refptr<NGLayoutResult> layout_result =
+          child.Layout(child_space, nullptr /*break token*/);
+      child_block_size =
+          NGFragment(child_style.GetWritingMode(),
+                     *layout_result->PhysicalFragment())
+              .BlockSize();
+    }
 
     LayoutUnit flex_base_border_box;
     Length length_in_main_axis =
         is_horizontal_flow ? child_style.Width() : child_style.Height();
     if (child_style.FlexBasis().IsAuto() && length_in_main_axis.IsAuto()) {
-      if (MainAxisIsInlineAxis(child))
+      if (main_axis_is_inline_axis)
         flex_base_border_box = min_max_sizes_border_box.max_size;
       else
-        flex_base_border_box = fragment_in_child_writing_mode.BlockSize();
+        flex_base_border_box = child_block_size;
     } else {
       Length length_to_resolve = child_style.FlexBasis();
       if (length_to_resolve.IsAuto())
         length_to_resolve = length_in_main_axis;
       DCHECK(!length_to_resolve.IsAuto());
 
-      if (MainAxisIsInlineAxis(child)) {
+      if (main_axis_is_inline_axis) {
         flex_base_border_box = ResolveInlineLength(
             child_space, child_style, min_max_sizes_border_box,
             length_to_resolve, LengthResolveType::kContentSize,
@@ -123,8 +134,7 @@ scoped_refptr<NGLayoutResult> NGFlexLayoutAlgorithm::Layout() {
         // Flex container's main axis is in child's block direction. Child's
         // flex basis is in child's block direction.
         flex_base_border_box = ResolveBlockLength(
-            child_space, child_style, length_to_resolve,
-            fragment_in_child_writing_mode.BlockSize(),
+            child_space, child_style, length_to_resolve, child_block_size,
             LengthResolveType::kContentSize, LengthResolvePhase::kLayout);
       }
     }
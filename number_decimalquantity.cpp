@@ -583,6 +583,23 @@ double DecimalQuantity::toDouble() const {
         return isNegative() ? -INFINITY : INFINITY;
     }
 
+    // Fast path: at most 15 digits fit exactly in a double, and so do the powers of ten in
+    // DOUBLE_MULTIPLIERS. A single multiplication or division then gives the correctly rounded
+    // result, the same one the string conversion below would produce.
+    if (precision <= 15 && scale > -22 && scale < 22) {
+        uint64_t digits = 0;
+        for (int32_t i = precision - 1; i >= 0; i--) {
+            digits = digits * 10 + getDigitPos(i);
+        }
+        auto result = static_cast<double>(digits);
+        if (scale >= 0) {
+            result *= DOUBLE_MULTIPLIERS[scale];
+        } else {
+            result /= DOUBLE_MULTIPLIERS[-scale];
+        }
+        return isNegative() ? -result : result;
+    }
+
     // We are processing well-formed input, so we don't need any special options to StringToDoubleConverter.
     StringToDoubleConverter converter(0, 0, 0, "", "");
     UnicodeString numberString = this->toScientificString();
@@ -7,6 +7,7 @@
 #include <memory>
 #include <utility>
 
+#include "base/optional.h"
 #include "cc/layers/layer.h"
 #include "cc/layers/picture_layer.h"
 #include "cc/paint/display_item_list.h"
@@ -395,16 +396,19 @@ static const EffectPaintPropertyNode* StrictChildOfAlongPath(
   return nullptr;
 }
 
+static FloatRect VisualRectInRootSpace(const FloatRect& bounds,
+                                       const PropertyTreeState& state) {
+  FloatClipRect visual_rect(bounds);
+  GeometryMapper::LocalToAncestorVisualRect(state, PropertyTreeState::Root(),
+                                            visual_rect);
+  return visual_rect.Rect();
+}
+
 bool PaintArtifactCompositor::MightOverlap(const PendingLayer& layer_a,
                                            const PendingLayer& layer_b) {
-  FloatClipRect bounds_a(layer_a.bounds);
-  GeometryMapper::LocalToAncestorVisualRect(
-      layer_a.property_tree_state, PropertyTreeState::Root(), bounds_a);
-  FloatClipRect bounds_b(layer_b.bounds);
-  GeometryMapper::LocalToAncestorVisualRect(
-      layer_b.property_tree_state, PropertyTreeState::Root(), bounds_b);
-
-  return bounds_a.Rect().Intersects(bounds_b.Rect());
+  return VisualRectInRootSpace(layer_a.bounds, layer_a.property_tree_state)
+      .Intersects(
+          VisualRectInRootSpace(layer_b.bounds, layer_b.property_tree_state));
 }
 
 bool PaintArtifactCompositor::CanDecompositeEffect(
@@ -551,6 +555,10 @@ void PaintArtifactCompositor::LayerizeGroup(
     const PendingLayer& new_layer = pending_layers.back();
     DCHECK(!new_layer.requires_own_layer);
     DCHECK_EQ(&current_group, new_layer.property_tree_state.Effect());
+    // The root space bounds of the new layer don't change while we look for a
+    // merge target, so map them lazily at most once instead of once for every
+    // candidate that fails to merge. This is equivalent to MightOverlap().
+    base::Optional<FloatRect> new_layer_bounds_in_root;
     // This iterates pendingLayers[firstLayerInCurrentGroup:-1] in reverse.
     for (size_t candidate_index = pending_layers.size() - 1;
          candidate_index-- > first_layer_in_current_group;) {
@@ -560,7 +568,12 @@ void PaintArtifactCompositor::LayerizeGroup(
         pending_layers.pop_back();
         break;
       }
-      if (MightOverlap(new_layer, candidate_layer))
+      if (!new_layer_bounds_in_root) {
+        new_layer_bounds_in_root = VisualRectInRootSpace(
+            new_layer.bounds, new_layer.property_tree_state);
+      }
+      if (new_layer_bounds_in_root->Intersects(VisualRectInRootSpace(
+              candidate_layer.bounds, candidate_layer.property_tree_state)))
         break;
     }
   }
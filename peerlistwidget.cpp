@@ -55,6 +55,18 @@
 #include "peerlistsortmodel.h"
 #include "peerlistwidget.h"
 
+namespace
+{
+    // Only touches the model when the value actually changed, so that periodic
+    // refreshes of large peer lists do not emit dataChanged for every cell.
+    void updateModelData(QStandardItemModel *model, int row, int column, const QVariant &value, int role = Qt::DisplayRole)
+    {
+        const QModelIndex index = model->index(row, column);
+        if (model->data(index, role) != value)
+            model->setData(index, value, role);
+    }
+}
+
 PeerListWidget::PeerListWidget(PropertiesWidget *parent)
     : QTreeView(parent)
     , m_properties(parent)
@@ -424,24 +436,24 @@ void PeerListWidget::updatePeer(const QString &ip, BitTorrent::TorrentHandle *co
         if (!ico.isNull()) {
             m_listModel->setData(m_listModel->index(row, PeerListDelegate::COUNTRY), ico, Qt::DecorationRole);
             const QString countryName = Net::GeoIPManager::CountryName(peer.country());
-            m_listModel->setData(m_listModel->index(row, PeerListDelegate::COUNTRY), countryName, Qt::ToolTipRole);
+            updateModelData(m_listModel, row, PeerListDelegate::COUNTRY, countryName, Qt::ToolTipRole);
             m_missingFlags.remove(ip);
         }
     }
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::CONNECTION), peer.connectionType());
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::PORT), peer.address().port);
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::FLAGS), peer.flags());
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::FLAGS), peer.flagsDescription(), Qt::ToolTipRole);
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::CLIENT), Utils::String::toHtmlEscaped(peer.client()));
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::PROGRESS), peer.progress());
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::DOWN_SPEED), peer.payloadDownSpeed());
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::UP_SPEED), peer.payloadUpSpeed());
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::TOT_DOWN), peer.totalDownload());
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::TOT_UP), peer.totalUpload());
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::RELEVANCE), peer.relevance());
+    updateModelData(m_listModel, row, PeerListDelegate::CONNECTION, peer.connectionType());
+    updateModelData(m_listModel, row, PeerListDelegate::PORT, peer.address().port);
+    updateModelData(m_listModel, row, PeerListDelegate::FLAGS, peer.flags());
+    updateModelData(m_listModel, row, PeerListDelegate::FLAGS, peer.flagsDescription(), Qt::ToolTipRole);
+    updateModelData(m_listModel, row, PeerListDelegate::CLIENT, Utils::String::toHtmlEscaped(peer.client()));
+    updateModelData(m_listModel, row, PeerListDelegate::PROGRESS, peer.progress());
+    updateModelData(m_listModel, row, PeerListDelegate::DOWN_SPEED, peer.payloadDownSpeed());
+    updateModelData(m_listModel, row, PeerListDelegate::UP_SPEED, peer.payloadUpSpeed());
+    updateModelData(m_listModel, row, PeerListDelegate::TOT_DOWN, peer.totalDownload());
+    updateModelData(m_listModel, row, PeerListDelegate::TOT_UP, peer.totalUpload());
+    updateModelData(m_listModel, row, PeerListDelegate::RELEVANCE, peer.relevance());
     QStringList downloadingFiles(torrent->info().filesForPiece(peer.downloadingPieceIndex()));
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::DOWNLOADING_PIECE), downloadingFiles.join(QLatin1String(";")));
-    m_listModel->setData(m_listModel->index(row, PeerListDelegate::DOWNLOADING_PIECE), downloadingFiles.join(QLatin1String("\n")), Qt::ToolTipRole);
+    updateModelData(m_listModel, row, PeerListDelegate::DOWNLOADING_PIECE, downloadingFiles.join(QLatin1String(";")));
+    updateModelData(m_listModel, row, PeerListDelegate::DOWNLOADING_PIECE, downloadingFiles.join(QLatin1String("\n")), Qt::ToolTipRole);
 }
 
 void PeerListWidget::handleResolved(const QString &ip, const QString &hostname)
@@ -19,17 +19,22 @@
 #include <string>
 #include <unistd.h>
 #include <iostream>
+#include <sys/resource.h>
 
 using namespace std;
 
 #include "common/ceph_argparse.h"
 #include "common/debug.h"
 #include "common/Cycles.h"
+#include "common/Formatter.h"
 #include "global/global_init.h"
+#include "include/str_list.h"
 #include "msg/Messenger.h"
 #include "messages/MOSDOp.h"
 
+#include <algorithm>
 #include <atomic>
+#include <deque>
 
 class MessengerClient {
   class ClientThread;
@@ -82,11 +87,16 @@ class MessengerClient {
     Mutex lock;
     Cond cond;
     uint64_t inflight;
+    // send stamps of inflight ops, replies come back in order on the
+    // single connection
+    deque<uint64_t> send_stamps;
+    vector<uint64_t> latencies;
 
     ClientThread(Messenger *m, int c, ConnectionRef con, int len, int ops, int think_time_us):
         msgr(m), concurrent(c), conn(con), oid("object-name"), oloc(1, 1), msg_len(len), ops(ops),
         dispatcher(think_time_us, this), lock("MessengerBenchmark::ClientThread::lock"), inflight(0) {
       m->add_dispatcher_head(&dispatcher);
+      latencies.reserve(ops);
       bufferptr ptr(msg_len);
       memset(ptr.c_str(), 0, msg_len);
       data.append(ptr);
@@ -103,9 +113,13 @@ class MessengerClient {
         MOSDOp *m = new MOSDOp(client_inc, 0, hobj, spgid, 0, 0, 0);
         m->write(0, msg_len, data);
         inflight++;
+        send_stamps.push_back(Cycles::rdtsc());
         conn->send_message(m);
         //cerr << __func__ << " send m=" << m << std::endl;
       }
+      // wait for the outstanding replies so every op has a latency sample
+      while (inflight > 0)
+        cond.Wait(lock);
       lock.Unlock();
       msgr->shutdown();
       return 0;
@@ -128,14 +142,15 @@ class MessengerClient {
     for (uint64_t i = 0; i < msgrs.size(); ++i) {
       msgrs[i]->shutdown();
       msgrs[i]->wait();
+      delete msgrs[i];
     }
   }
-  void ready(int c, int jobs, int ops, int msg_len) {
+  void ready(int c, int jobs, int ops, int msg_len, uint64_t nonce_base = 0) {
     entity_addr_t addr;
     addr.parse(serveraddr.c_str());
     addr.set_nonce(0);
     for (int i = 0; i < jobs; ++i) {
-      Messenger *msgr = Messenger::create(g_ceph_context, type, entity_name_t::CLIENT(0), "client", getpid()+i, 0);
+      Messenger *msgr = Messenger::create(g_ceph_context, type, entity_name_t::CLIENT(0), "client", getpid()+nonce_base+i, 0);
       msgr->set_default_policy(Messenger::Policy::lossless_client(0));
       entity_inst_t inst(entity_name_t::OSD(0), addr);
       ConnectionRef conn = msgr->get_connection(inst);
@@ -152,17 +167,98 @@ class MessengerClient {
     for (uint64_t i = 0; i < msgrs.size(); ++i)
       msgrs[i]->wait();
   }
+  // op latencies in cycles of all client threads, sorted
+  vector<uint64_t> get_latencies() {
+    vector<uint64_t> all;
+    for (auto t : clients)
+      all.insert(all.end(), t->latencies.begin(), t->latencies.end());
+    std::sort(all.begin(), all.end());
+    return all;
+  }
 };
 
 void MessengerClient::ClientDispatcher::ms_fast_dispatch(Message *m) {
+  // take the reply stamp before thinking, so latency excludes think time
+  uint64_t now = Cycles::rdtsc();
   usleep(think_time);
   m->put();
   Mutex::Locker l(thread->lock);
+  if (!thread->send_stamps.empty()) {
+    thread->latencies.push_back(now - thread->send_stamps.front());
+    thread->send_stamps.pop_front();
+  }
   thread->inflight--;
   thread->cond.Signal();
 }
 
 
+static double percentile_us(const vector<uint64_t> &sorted, double p)
+{
+  if (sorted.empty())
+    return 0;
+  size_t i = std::min(sorted.size() - 1, size_t(p * sorted.size()));
+  return Cycles::to_microseconds(sorted[i]);
+}
+
+static double cpu_seconds()
+{
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_utime.tv_sec + ru.ru_utime.tv_usec / 1e6 +
+         ru.ru_stime.tv_sec + ru.ru_stime.tv_usec / 1e6;
+}
+
+static vector<int> parse_int_list(const char *s)
+{
+  list<string> l;
+  get_str_list(s, ",", l);
+  vector<int> v;
+  for (auto &i : l)
+    v.push_back(atoi(i.c_str()));
+  return v;
+}
+
+// run one point of the benchmark matrix and dump its results
+static void run_one(Formatter *f, const string &type, const char *serveraddr,
+                    int numjobs, int concurrent, int ios, int think_time,
+                    int len, uint64_t nonce_base)
+{
+  MessengerClient client(type, serveraddr, think_time);
+
+  client.ready(concurrent, numjobs, ios, len, nonce_base);
+  double cpu_start = cpu_seconds();
+  uint64_t start = Cycles::rdtsc();
+  client.start();
+  uint64_t stop = Cycles::rdtsc();
+  double cpu = cpu_seconds() - cpu_start;
+  vector<uint64_t> lat = client.get_latencies();
+  uint64_t total_ops = uint64_t(ios) * numjobs;
+  double run_us = Cycles::to_microseconds(stop - start);
+
+  if (!f) {
+    cerr << " Total op " << ios << " run time " << run_us << "us." << std::endl;
+    return;
+  }
+  f->open_object_section("run");
+  f->dump_string("msgr_type", type);
+  f->dump_int("numjobs", numjobs);
+  f->dump_int("concurrency", concurrent);
+  f->dump_int("msg_len", len);
+  f->dump_unsigned("ops", total_ops);
+  f->dump_float("run_time_us", run_us);
+  f->dump_float("iops", run_us > 0 ? total_ops * 1e6 / run_us : 0);
+  f->dump_float("cpu_us_per_op", total_ops ? cpu * 1e6 / total_ops : 0);
+  f->open_object_section("latency_us");
+  f->dump_float("p50", percentile_us(lat, 0.50));
+  f->dump_float("p99", percentile_us(lat, 0.99));
+  f->dump_float("p999", percentile_us(lat, 0.999));
+  f->dump_float("max", lat.empty() ? 0 : Cycles::to_microseconds(lat.back()));
+  f->close_section();
+  f->close_section();
+  f->flush(cout);
+  cout << std::endl;
+}
+
 void usage(const string &name) {
   cerr << "Usage: " << name << " [server ip:port] [numjobs] [concurrency] [ios] [thinktime us] [msg length]" << std::endl;
   cerr << "       [server ip:port]: connect to the ip:port pair" << std::endl;
@@ -171,6 +267,11 @@ void usage(const string &name) {
   cerr << "       [ios]: how much messages sent for each client" << std::endl;
   cerr << "       [thinktime]: sleep time when do fast dispatching(match client logic)" << std::endl;
   cerr << "       [msg length]: message data bytes" << std::endl;
+  cerr << "       numjobs, concurrency and msg length accept comma separated lists," << std::endl;
+  cerr << "       every combination of them is run in turn" << std::endl;
+  cerr << "       --msgr-types <type>[,<type>...]: messenger types to sweep, the" << std::endl;
+  cerr << "                                        default is ms_public_type/ms_type" << std::endl;
+  cerr << "       --json: print latency percentiles and cpu per op of each run as json" << std::endl;
 }
 
 int main(int argc, char **argv)
@@ -183,35 +284,64 @@ int main(int argc, char **argv)
   common_init_finish(g_ceph_context);
   g_ceph_context->_conf->apply_changes(NULL);
 
+  bool json = false;
+  std::string msgr_types;
+  std::string val;
+  for (auto i = args.begin(); i != args.end(); ) {
+    if (ceph_argparse_double_dash(args, i)) {
+      break;
+    } else if (ceph_argparse_flag(args, i, "--json", (char*)NULL)) {
+      json = true;
+    } else if (ceph_argparse_witharg(args, i, &val, "--msgr-types", (char*)NULL)) {
+      msgr_types = val;
+    } else {
+      ++i;
+    }
+  }
+
   if (args.size() < 6) {
     usage(argv[0]);
     return 1;
   }
 
-  int numjobs = atoi(args[1]);
-  int concurrent = atoi(args[2]);
+  vector<int> numjobs = parse_int_list(args[1]);
+  vector<int> concurrent = parse_int_list(args[2]);
   int ios = atoi(args[3]);
   int think_time = atoi(args[4]);
-  int len = atoi(args[5]);
+  vector<int> len = parse_int_list(args[5]);
 
-  std::string public_msgr_type = g_ceph_context->_conf->ms_public_type.empty() ? g_ceph_context->_conf->get_val<std::string>("ms_type") : g_ceph_context->_conf->ms_public_type;
+  list<string> types;
+  if (msgr_types.empty()) {
+    std::string public_msgr_type = g_ceph_context->_conf->ms_public_type.empty() ? g_ceph_context->_conf->get_val<std::string>("ms_type") : g_ceph_context->_conf->ms_public_type;
+    types.push_back(public_msgr_type);
+  } else {
+    get_str_list(msgr_types, ",", types);
+  }
 
-  cerr << " using ms-public-type " << public_msgr_type << std::endl;
+  cerr << " using ms-public-type " << types << std::endl;
   cerr << "       server ip:port " << args[0] << std::endl;
-  cerr << "       numjobs " << numjobs << std::endl;
-  cerr << "       concurrency " << concurrent << std::endl;
+  cerr << "       numjobs " << args[1] << std::endl;
+  cerr << "       concurrency " << args[2] << std::endl;
   cerr << "       ios " << ios << std::endl;
   cerr << "       thinktime(us) " << think_time << std::endl;
-  cerr << "       message data bytes " << len << std::endl;
+  cerr << "       message data bytes " << args[5] << std::endl;
 
-  MessengerClient client(public_msgr_type, args[0], think_time);
+  std::unique_ptr<Formatter> f;
+  if (json)
+    f.reset(Formatter::create("json"));
 
-  client.ready(concurrent, numjobs, ios, len);
   Cycles::init();
-  uint64_t start = Cycles::rdtsc();
-  client.start();
-  uint64_t stop = Cycles::rdtsc();
-  cerr << " Total op " << ios << " run time " << Cycles::to_microseconds(stop - start) << "us." << std::endl;
+  uint64_t nonce_base = 0;
+  for (auto &type : types) {
+    for (int j : numjobs) {
+      for (int c : concurrent) {
+        for (int l : len) {
+          run_one(f.get(), type, args[0], j, c, ios, think_time, l, nonce_base);
+          nonce_base += j;
+        }
+      }
+    }
+  }
 
   return 0;
 }
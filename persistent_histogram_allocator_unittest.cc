@@ -335,6 +335,49 @@ TEST_F(PersistentHistogramAllocatorTest, StatisticsRecorderMerge) {
   EXPECT_EQ(1, snapshot->GetCount(7));
 }
 
+TEST_F(PersistentHistogramAllocatorTest, StatisticsRecorderMergeUnchanged) {
+  const char LinearHistogramName[] = "SRTUnchangedLinearHistogram";
+  const size_t starting_sr_count = StatisticsRecorder::GetHistogramCount();
+
+  // Create a histogram without samples in a local SR and allocator, as in
+  // the StatisticsRecorderMerge test above.
+  std::unique_ptr<StatisticsRecorder> local_sr =
+      StatisticsRecorder::CreateTemporaryForTesting();
+  std::unique_ptr<GlobalHistogramAllocator> old_allocator =
+      GlobalHistogramAllocator::ReleaseForTesting();
+  GlobalHistogramAllocator::CreateWithLocalMemory(kAllocatorMemorySize, 0, "");
+  ASSERT_TRUE(GlobalHistogramAllocator::Get());
+  HistogramBase* histogram =
+      LinearHistogram::FactoryGet(LinearHistogramName, 1, 10, 10, 0);
+  ASSERT_TRUE(histogram);
+
+  std::unique_ptr<GlobalHistogramAllocator> new_allocator =
+      GlobalHistogramAllocator::ReleaseForTesting();
+  local_sr.reset();
+  GlobalHistogramAllocator::Set(std::move(old_allocator));
+
+  PersistentHistogramAllocator recovery(
+      std::make_unique<PersistentMemoryAllocator>(
+          const_cast<void*>(new_allocator->memory_allocator()->data()),
+          new_allocator->memory_allocator()->size(), 0, 0, "", false));
+  PersistentHistogramAllocator::Iterator histogram_iter(&recovery);
+
+  // Merging a histogram that has nothing new doesn't touch the global SR.
+  std::unique_ptr<HistogramBase> recovered = histogram_iter.GetNext();
+  ASSERT_TRUE(recovered);
+  recovery.MergeHistogramDeltaToStatisticsRecorder(recovered.get());
+  EXPECT_EQ(starting_sr_count, StatisticsRecorder::GetHistogramCount());
+  EXPECT_FALSE(StatisticsRecorder::FindHistogram(LinearHistogramName));
+
+  // Once it has samples, the merge creates it and adds them.
+  recovered->Add(3);
+  recovery.MergeHistogramDeltaToStatisticsRecorder(recovered.get());
+  EXPECT_EQ(starting_sr_count + 1, StatisticsRecorder::GetHistogramCount());
+  HistogramBase* found = StatisticsRecorder::FindHistogram(LinearHistogramName);
+  ASSERT_TRUE(found);
+  EXPECT_EQ(1, found->SnapshotSamples()->GetCount(3));
+}
+
 TEST_F(PersistentHistogramAllocatorTest, RangesDeDuplication) {
   // This corresponds to the "ranges_ref" field of the PersistentHistogramData
   // structure defined (privately) inside persistent_histogram_allocator.cc.
@@ -286,10 +286,8 @@ bool Pickle::ReadLength(void** iter, int* result) const {
 }
 
 bool Pickle::WriteString(const std::string& value) {
-  if (!WriteInt(static_cast<int>(value.size())))
-    return false;
-
-  return WriteBytes(value.data(), static_cast<int>(value.size()));
+  // The length prefix counts bytes, so this is the same encoding as WriteData.
+  return WriteData(value.data(), static_cast<int>(value.size()));
 }
 
 bool Pickle::WriteWString(const std::wstring& value) {
@@ -309,7 +307,22 @@ bool Pickle::WriteString16(const string16& value) {
 }
 
 bool Pickle::WriteData(const char* data, int length) {
-  return length >= 0 && WriteInt(length) && WriteBytes(data, length);
+  DCHECK(capacity_ != kCapacityReadOnly) << "oops: pickle is readonly";
+  if (length < 0)
+    return false;
+
+  // Reserve the length prefix and the bytes together so that growing the
+  // pickle costs at most one realloc. The prefix is uint32-aligned and
+  // sizeof(int) long, so the layout matches WriteInt() + WriteBytes().
+  char* dest = BeginWrite(sizeof(int) + length);
+  if (!dest)
+    return false;
+
+  memcpy(dest, &length, sizeof(int));
+  memcpy(dest + sizeof(int), data, length);
+
+  EndWrite(dest, sizeof(int) + length);
+  return true;
 }
 
 bool Pickle::WriteBytes(const void* data, int data_len) {
@@ -301,9 +301,14 @@ void PicturePileImpl::GatherPixelRefs(
     float contents_scale,
     std::vector<SkPixelRef*>* pixel_refs) const {
   DCHECK_EQ(0u, pixel_refs->size());
+  // An image that spans several picture grid cells or several recorded
+  // pictures is reported once per cell. Only return each pixel ref once, so
+  // that rasterizing the tile doesn't depend on decoding it multiple times.
+  std::set<SkPixelRef*> pixel_refs_seen;
   for (PixelRefIterator iter(content_rect, contents_scale, this); iter;
        ++iter) {
-    pixel_refs->push_back(*iter);
+    if (pixel_refs_seen.insert(*iter).second)
+      pixel_refs->push_back(*iter);
   }
 }
 
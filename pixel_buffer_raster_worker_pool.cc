@@ -453,90 +453,124 @@ void PixelBufferRasterWorkerPool::ScheduleMoreTasks() {
   TaskGraph graph;
 
   size_t bytes_pending_upload = bytes_pending_upload_;
-  bool did_throttle_raster_tasks = false;
 
+  // Tasks of either type whose raster has already completed are waiting for
+  // their upload, so their bytes are committed. Count them before scheduling
+  // any new raster work, so that the passes below stay within the upload
+  // budget.
   for (RasterTaskVector::const_iterator it = raster_tasks().begin();
        it != raster_tasks().end(); ++it) {
     internal::RasterWorkerPoolTask* task = it->get();
 
-    // |pixel_buffer_tasks_| contains all tasks that have not yet completed.
     TaskMap::iterator pixel_buffer_it = pixel_buffer_tasks_.find(task);
     if (pixel_buffer_it == pixel_buffer_tasks_.end())
       continue;
-
-    // HasFinishedRunning() will return true when set pixels has completed.
-    if (task->HasFinishedRunning()) {
-      DCHECK(std::find(completed_tasks_.begin(),
-                       completed_tasks_.end(),
-                       task) != completed_tasks_.end());
+    if (task->HasFinishedRunning())
       continue;
-    }
 
-    // All raster tasks need to be throttled by bytes of pending uploads.
-    size_t new_bytes_pending_upload = bytes_pending_upload;
-    new_bytes_pending_upload += task->resource()->bytes();
-    if (new_bytes_pending_upload > max_bytes_pending_upload_) {
-      did_throttle_raster_tasks = true;
-      break;
-    }
+    internal::WorkerPoolTask* pixel_buffer_task =
+        pixel_buffer_it->second.get();
+    if (pixel_buffer_task && pixel_buffer_task->HasCompleted())
+      bytes_pending_upload += task->resource()->bytes();
+  }
+  bool did_throttle_raster_tasks =
+      bytes_pending_upload > max_bytes_pending_upload_;
+
+  // Tasks required for activation get first claim on the upload budget and
+  // the scheduled task limit, so that prepaint work can't hold up activation
+  // during fast scrolls. Within each type, raster_tasks() priority order is
+  // kept.
+  const RasterTaskType kTypesInScheduleOrder[] = {
+    REQUIRED_FOR_ACTIVATION_TYPE,
+    PREPAINT_TYPE
+  };
+  for (size_t pass = 0;
+       pass < arraysize(kTypesInScheduleOrder) && !did_throttle_raster_tasks;
+       ++pass) {
+    for (RasterTaskVector::const_iterator it = raster_tasks().begin();
+         it != raster_tasks().end(); ++it) {
+      internal::RasterWorkerPoolTask* task = it->get();
 
-    internal::WorkerPoolTask* pixel_buffer_task = pixel_buffer_it->second.get();
+      RasterTaskType type = IsRasterTaskRequiredForActivation(task) ?
+          REQUIRED_FOR_ACTIVATION_TYPE :
+          PREPAINT_TYPE;
+      if (type != kTypesInScheduleOrder[pass])
+        continue;
 
-    // If raster has finished, just update |bytes_pending_upload|.
-    if (pixel_buffer_task && pixel_buffer_task->HasCompleted()) {
-      bytes_pending_upload = new_bytes_pending_upload;
-      continue;
-    }
+      // |pixel_buffer_tasks_| contains all tasks that have not yet completed.
+      TaskMap::iterator pixel_buffer_it = pixel_buffer_tasks_.find(task);
+      if (pixel_buffer_it == pixel_buffer_tasks_.end())
+        continue;
 
-    // Throttle raster tasks based on kMaxScheduledRasterTasks.
-    size_t scheduled_raster_task_count =
-        tasks[PREPAINT_TYPE].container().size() +
-        tasks[REQUIRED_FOR_ACTIVATION_TYPE].container().size();
-    if (scheduled_raster_task_count >= kMaxScheduledRasterTasks) {
-      did_throttle_raster_tasks = true;
-      break;
-    }
+      // HasFinishedRunning() will return true when set pixels has completed.
+      if (task->HasFinishedRunning()) {
+        DCHECK(std::find(completed_tasks_.begin(),
+                         completed_tasks_.end(),
+                         task) != completed_tasks_.end());
+        continue;
+      }
+
+      internal::WorkerPoolTask* pixel_buffer_task =
+          pixel_buffer_it->second.get();
 
-    // Update |bytes_pending_upload| now that task has cleared all
-    // throttling limits.
-    bytes_pending_upload = new_bytes_pending_upload;
+      // If raster has finished, its bytes were counted above.
+      if (pixel_buffer_task && pixel_buffer_task->HasCompleted())
+        continue;
+
+      // All raster tasks need to be throttled by bytes of pending uploads.
+      size_t new_bytes_pending_upload = bytes_pending_upload;
+      new_bytes_pending_upload += task->resource()->bytes();
+      if (new_bytes_pending_upload > max_bytes_pending_upload_) {
+        did_throttle_raster_tasks = true;
+        break;
+      }
 
-    RasterTaskType type = IsRasterTaskRequiredForActivation(task) ?
-        REQUIRED_FOR_ACTIVATION_TYPE :
-        PREPAINT_TYPE;
+      // Throttle raster tasks based on kMaxScheduledRasterTasks.
+      size_t scheduled_raster_task_count =
+          tasks[PREPAINT_TYPE].container().size() +
+          tasks[REQUIRED_FOR_ACTIVATION_TYPE].container().size();
+      if (scheduled_raster_task_count >= kMaxScheduledRasterTasks) {
+        did_throttle_raster_tasks = true;
+        break;
+      }
 
-    // Use existing pixel buffer task if available.
-    if (pixel_buffer_task) {
+      // Update |bytes_pending_upload| now that task has cleared all
+      // throttling limits.
+      bytes_pending_upload = new_bytes_pending_upload;
+
+      // Use existing pixel buffer task if available.
+      if (pixel_buffer_task) {
+        tasks[type].container().push_back(
+            CreateGraphNodeForRasterTask(pixel_buffer_task,
+                                         task->dependencies(),
+                                         priority++,
+                                         &graph));
+        continue;
+      }
+
+      // Request a pixel buffer. This will reserve shared memory.
+      resource_provider()->AcquirePixelBuffer(task->resource()->id());
+
+      // MapPixelBuffer() returns NULL if context was lost at the time
+      // AcquirePixelBuffer() was called. For simplicity we still post
+      // a raster task that is essentially a noop in these situations.
+      uint8* buffer = resource_provider()->MapPixelBuffer(
+          task->resource()->id());
+
+      scoped_refptr<internal::WorkerPoolTask> new_pixel_buffer_task(
+          new PixelBufferWorkerPoolTaskImpl(
+              task,
+              buffer,
+              base::Bind(&PixelBufferRasterWorkerPool::OnRasterTaskCompleted,
+                         base::Unretained(this),
+                         make_scoped_refptr(task))));
+      pixel_buffer_tasks_[task] = new_pixel_buffer_task;
       tasks[type].container().push_back(
-          CreateGraphNodeForRasterTask(pixel_buffer_task,
+          CreateGraphNodeForRasterTask(new_pixel_buffer_task.get(),
                                        task->dependencies(),
                                        priority++,
                                        &graph));
-      continue;
     }
-
-    // Request a pixel buffer. This will reserve shared memory.
-    resource_provider()->AcquirePixelBuffer(task->resource()->id());
-
-    // MapPixelBuffer() returns NULL if context was lost at the time
-    // AcquirePixelBuffer() was called. For simplicity we still post
-    // a raster task that is essentially a noop in these situations.
-    uint8* buffer = resource_provider()->MapPixelBuffer(
-        task->resource()->id());
-
-    scoped_refptr<internal::WorkerPoolTask> new_pixel_buffer_task(
-        new PixelBufferWorkerPoolTaskImpl(
-            task,
-            buffer,
-            base::Bind(&PixelBufferRasterWorkerPool::OnRasterTaskCompleted,
-                       base::Unretained(this),
-                       make_scoped_refptr(task))));
-    pixel_buffer_tasks_[task] = new_pixel_buffer_task;
-    tasks[type].container().push_back(
-        CreateGraphNodeForRasterTask(new_pixel_buffer_task.get(),
-                                     task->dependencies(),
-                                     priority++,
-                                     &graph));
   }
 
   scoped_refptr<internal::WorkerPoolTask>
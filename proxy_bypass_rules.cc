@@ -73,13 +73,17 @@ class HostnamePatternRule : public ProxyBypassRules::Rule {
     if (optional_port_ != -1 && url.EffectiveIntPort() != optional_port_)
       return Result::kNoMatch;  // Didn't match port expectation.
 
-    if (!optional_scheme_.empty() && url.scheme() != optional_scheme_)
+    if (!optional_scheme_.empty() && url.scheme_piece() != optional_scheme_)
       return Result::kNoMatch;  // Didn't match scheme expectation.
 
     // Note it is necessary to lower-case the host, since GURL uses capital
     // letters for percent-escaped characters.
-    return base::MatchPattern(url.host(), hostname_pattern_) ? Result::kBypass
-                                                             : Result::kNoMatch;
+    //
+    // Every rule in the list is evaluated for every request, so match against
+    // the URL's own storage instead of copying the host for each rule.
+    return base::MatchPattern(url.host_piece(), hostname_pattern_)
+               ? Result::kBypass
+               : Result::kNoMatch;
   }
 
   std::string ToString() const override {
@@ -106,11 +110,11 @@ class WinLocalRule : public ProxyBypassRules::Rule {
   WinLocalRule() = default;
 
   Result Evaluate(const GURL& url) const override {
-    const std::string& host = url.host();
+    base::StringPiece host = url.host_piece();
     if (host == "127.0.0.1" || host == "[::1]")
       return Result::kBypass;
-    return (host.find('.') == std::string::npos) ? Result::kBypass
-                                                 : Result::kNoMatch;
+    return (host.find('.') == base::StringPiece::npos) ? Result::kBypass
+                                                       : Result::kNoMatch;
   }
 
   std::string ToString() const override { return kWinLocal; }
@@ -153,7 +157,7 @@ class IPBlockRule : public ProxyBypassRules::Rule {
     if (!url.HostIsIPAddress())
       return Result::kNoMatch;
 
-    if (!optional_scheme_.empty() && url.scheme() != optional_scheme_)
+    if (!optional_scheme_.empty() && url.scheme_piece() != optional_scheme_)
       return Result::kNoMatch;  // Didn't match scheme expectation.
 
     // Parse the input IP literal to a number.
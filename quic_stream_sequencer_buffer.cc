@@ -177,10 +177,8 @@ QuicErrorCode QuicStreamSequencerBuffer::OnStreamData(
     }
 
     if (blocks_ == nullptr) {
+      // Value-initialization leaves every block pointer null.
       blocks_.reset(new BufferBlock*[blocks_count_]());
-      for (size_t i = 0; i < blocks_count_; ++i) {
-        blocks_[i] = nullptr;
-      }
     }
 
     if (write_block_num >= blocks_count_) {
@@ -199,7 +197,9 @@ QuicErrorCode QuicStreamSequencerBuffer::OnStreamData(
     if (blocks_[write_block_num] == nullptr) {
       // TODO(danzh): Investigate if using a freelist would improve performance.
       // Same as RetireBlock().
-      blocks_[write_block_num] = new BufferBlock();
+      // Default-initialize the block: only bytes that have been written are
+      // ever exposed to readers, so zero-filling kBlockSizeBytes is wasted.
+      blocks_[write_block_num] = new BufferBlock;
     }
 
     const size_t bytes_to_copy =
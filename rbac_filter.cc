@@ -70,16 +70,22 @@ Http::FilterHeadersStatus RoleBasedAccessControlFilter::decodeHeaders(Http::Head
             headers, callbacks_->streamInfo().dynamicMetadata().DebugString());
 
   std::string effective_policy_id;
+  // Resolve the route once; both engine lookups below walk the same per-route filter config.
+  const Router::RouteConstSharedPtr route = callbacks_->route();
   const auto shadow_engine =
-      config_->engine(callbacks_->route(), Filters::Common::RBAC::EnforcementMode::Shadow);
+      config_->engine(route, Filters::Common::RBAC::EnforcementMode::Shadow);
+  const auto engine = config_->engine(route, Filters::Common::RBAC::EnforcementMode::Enforced);
 
-  if (shadow_engine != nullptr) {
-    std::string shadow_resp_code =
-        Filters::Common::RBAC::DynamicMetadataKeysSingleton::get().EngineResultAllowed;
+  if (shadow_engine != nullptr || engine != nullptr) {
     // Refresh headers byte size before checking if allowed.
     // TODO(asraa): Remove this when entries in HeaderMap can no longer be modified by reference and
     // HeaderMap holds an accurate internal byte size count.
     headers.refreshByteSize();
+  }
+
+  if (shadow_engine != nullptr) {
+    std::string shadow_resp_code =
+        Filters::Common::RBAC::DynamicMetadataKeysSingleton::get().EngineResultAllowed;
     if (shadow_engine->allowed(*callbacks_->connection(), headers, callbacks_->streamInfo(),
                                &effective_policy_id)) {
       ENVOY_LOG(debug, "shadow allowed");
@@ -106,13 +112,7 @@ Http::FilterHeadersStatus RoleBasedAccessControlFilter::decodeHeaders(Http::Head
     callbacks_->streamInfo().setDynamicMetadata(HttpFilterNames::get().Rbac, metrics);
   }
 
-  const auto engine =
-      config_->engine(callbacks_->route(), Filters::Common::RBAC::EnforcementMode::Enforced);
   if (engine != nullptr) {
-    // Refresh headers byte size before checking if allowed.
-    // TODO(asraa): Remove this when entries in HeaderMap can no longer be modified by reference and
-    // HeaderMap holds an accurate internal byte size count.
-    headers.refreshByteSize();
     if (engine->allowed(*callbacks_->connection(), headers, callbacks_->streamInfo(), nullptr)) {
       ENVOY_LOG(debug, "enforced allowed");
       config_->stats().allowed_.inc();
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
 #include <vector>
 
 #if defined(OS_POSIX)
@@ -212,6 +213,14 @@ class RendererURLRequestContextSelector
 base::LazyInstance<IDMap<RenderProcessHost> >::Leaky
     g_all_hosts = LAZY_INSTANCE_INITIALIZER;
 
+// Time at which each out-of-process renderer launch was started, keyed by
+// host ID.  Entries are consumed by OnProcessLaunched() to record how long
+// navigations to a new process wait for the launch.  Only used on the UI
+// thread.
+typedef std::map<int, base::TimeTicks> LaunchStartTimeMap;
+base::LazyInstance<LaunchStartTimeMap>::Leaky
+    g_launch_start_times = LAZY_INSTANCE_INITIALIZER;
+
 // Map of site to process, to ensure we only have one RenderProcessHost per
 // site in process-per-site mode.  Each map is specific to a BrowserContext.
 class SiteProcessMap : public base::SupportsUserData::Data {
@@ -369,6 +378,7 @@ RenderProcessHostImpl::~RenderProcessHostImpl() {
   }
 
   ClearTransportDIBCache();
+  g_launch_start_times.Get().erase(GetID());
   UnregisterHost(GetID());
 }
 
@@ -456,6 +466,8 @@ bool RenderProcessHostImpl::Init() {
     AppendRendererCommandLine(cmd_line);
     cmd_line->AppendSwitchASCII(switches::kProcessChannelID, channel_id);
 
+    g_launch_start_times.Get()[GetID()] = base::TimeTicks::Now();
+
     // Spawn the child process asynchronously to avoid blocking the UI thread.
     // As long as there's no renderer prefix, we can use the zygote process
     // at this stage.
@@ -1549,6 +1561,16 @@ void RenderProcessHostImpl::OnProcessLaunched() {
   if (deleting_soon_)
     return;
 
+  LaunchStartTimeMap& launch_start_times = g_launch_start_times.Get();
+  LaunchStartTimeMap::iterator launch_start = launch_start_times.find(GetID());
+  if (launch_start != launch_start_times.end()) {
+    base::TimeDelta launch_time = base::TimeTicks::Now() - launch_start->second;
+    launch_start_times.erase(launch_start);
+    if (child_process_launcher_.get() && child_process_launcher_->GetHandle()) {
+      UMA_HISTOGRAM_TIMES("MPArch.RendererLaunchTime", launch_time);
+    }
+  }
+
   if (child_process_launcher_.get()) {
     if (!child_process_launcher_->GetHandle()) {
       OnChannelError();
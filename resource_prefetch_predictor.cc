@@ -4,6 +4,7 @@
 
 #include "chrome/browser/predictors/resource_prefetch_predictor.h"
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <utility>
@@ -325,6 +326,8 @@ bool ResourcePrefetchPredictor::PredictPreconnectOrigins(
   net::NetworkIsolationKey network_isolation_key(redirect_origin,
                                                  redirect_origin);
 
+  size_t first_learned_request =
+      prediction ? prediction->requests.size() : 0;
   for (const OriginStat& origin : data.origins()) {
     float confidence = static_cast<float>(origin.number_of_hits()) /
                        (origin.number_of_hits() + origin.number_of_misses());
@@ -345,6 +348,18 @@ bool ResourcePrefetchPredictor::PredictPreconnectOrigins(
     }
   }
 
+  // PreconnectManager only keeps a few preresolves in flight at once, so put
+  // the confident origins that get a socket ahead of the preresolve-only ones.
+  // The learned order is kept within each group.
+  if (prediction) {
+    std::stable_partition(
+        prediction->requests.begin() + first_learned_request,
+        prediction->requests.end(),
+        [](const PreconnectRequest& request) {
+          return request.num_sockets > 0;
+        });
+  }
+
   return has_any_prediction;
 }
 
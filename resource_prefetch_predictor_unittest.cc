@@ -940,4 +940,42 @@ TEST_F(ResourcePrefetchPredictorTest,
   EXPECT_EQ(expected_prediction_redirected_to, *prediction);
 }
 
+// Origins that are preconnected should be ordered before the origins that are
+// only preresolved, regardless of the order in which they were learned.
+TEST_F(ResourcePrefetchPredictorTest,
+       TestPredictPreconnectOrigins_PreconnectsFirst) {
+  const GURL main_frame_url("http://google.com/?query=cats");
+  const url::Origin origin = url::Origin::Create(main_frame_url);
+  const net::NetworkIsolationKey network_isolation_key(origin, origin);
+
+  const char* cdn_origin = "https://cdn%d.google.com";
+  auto gen_origin = [cdn_origin](int n) {
+    return base::StringPrintf(cdn_origin, n);
+  };
+
+  OriginData google = CreateOriginData("google.com");
+  InitializeOriginStat(google.add_origins(), gen_origin(1), 10, 5, 0, 1.0, true,
+                       true);  // Medium confidence - preresolve.
+  InitializeOriginStat(google.add_origins(), gen_origin(2), 10, 0, 0, 2.0, true,
+                       true);  // High confidence - preconnect.
+  InitializeOriginStat(google.add_origins(), gen_origin(3), 10, 5, 0, 3.0, true,
+                       true);  // Medium confidence - preresolve.
+  InitializeOriginStat(google.add_origins(), gen_origin(4), 10, 0, 0, 4.0, true,
+                       true);  // High confidence - preconnect.
+  predictor_->origin_data_->UpdateData(google.host(), google);
+
+  auto prediction = std::make_unique<PreconnectPrediction>();
+  EXPECT_TRUE(
+      predictor_->PredictPreconnectOrigins(main_frame_url, prediction.get()));
+  EXPECT_EQ(
+      *prediction,
+      CreatePreconnectPrediction(
+          "google.com", false,
+          {{url::Origin::Create(GURL(gen_origin(2))), 1, network_isolation_key},
+           {url::Origin::Create(GURL(gen_origin(4))), 1, network_isolation_key},
+           {url::Origin::Create(GURL(gen_origin(1))), 0, network_isolation_key},
+           {url::Origin::Create(GURL(gen_origin(3))), 0,
+            network_isolation_key}}));
+}
+
 }  // namespace predictors
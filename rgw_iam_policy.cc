@@ -378,6 +378,18 @@ bool operator <(const ARN& l, const ARN& r) {
 	  (l.resource < r.resource));
 }
 
+namespace {
+// Literal ARN fields usually match exactly, so accept those without
+// running the wildcard matcher. Anything else still goes through
+// match_policy, which also handles case-insensitive matches.
+bool match_arn_field(const std::string& pattern, const std::string& input) {
+  if (pattern == input) {
+    return true;
+  }
+  return match_policy(pattern, input, MATCH_POLICY_ARN);
+}
+}
+
 // The candidate is not allowed to have wildcards. The only way to
 // do that sanely would be to use unification rather than matching.
 bool ARN::match(const ARN& candidate) const {
@@ -392,15 +404,15 @@ bool ARN::match(const ARN& candidate) const {
     return false;
   }
 
-  if (!match_policy(region, candidate.region, MATCH_POLICY_ARN)) {
+  if (!match_arn_field(region, candidate.region)) {
     return false;
   }
 
-  if (!match_policy(account, candidate.account, MATCH_POLICY_ARN)) {
+  if (!match_arn_field(account, candidate.account)) {
     return false;
   }
 
-  if (!match_policy(resource, candidate.resource, MATCH_POLICY_ARN)) {
+  if (!match_arn_field(resource, candidate.resource)) {
     return false;
   }
 
@@ -1251,6 +1263,12 @@ string to_string(const Condition& c) {
 Effect Statement::eval(const Environment& e,
 		       optional<const rgw::auth::Identity&> ida,
 		       uint64_t act, const ARN& res) const {
+  // The action bits are the cheapest test and rule out most statements of
+  // a large policy, so check them before principals and resource ARNs.
+  if (!(action & act) || (notaction & act)) {
+    return Effect::Pass;
+  }
+
   if (ida && (!ida->is_identity(princ) || ida->is_identity(noprinc))) {
     return Effect::Pass;
   }
@@ -1267,10 +1285,6 @@ Effect Statement::eval(const Environment& e,
     return Effect::Pass;
   }
 
-  if (!(action & act) || (notaction & act)) {
-    return Effect::Pass;
-  }
-
   if (std::all_of(conditions.begin(),
 		  conditions.end(),
 		  [&e](const Condition& c) { return c.eval(e);})) {
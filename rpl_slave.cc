@@ -3545,16 +3545,17 @@ apply_event_and_update_pos(Log_event** ptr_ev, THD* thd, Relay_log_info* rli)
         // Reset mts in-group state
         if (rli->mts_group_status == Relay_log_info::MTS_END_GROUP)
         {
-          // CGAP cleanup
-          for (uint i= rli->curr_group_assigned_parts.elements; i > 0; i--)
-            delete_dynamic_element(&rli->
-                                   curr_group_assigned_parts, i - 1);
+          /*
+            CGAP cleanup. The array only holds pointers into the
+            partition hash, so dropping the elements is enough; removing
+            them one by one from the tail would do the same in O(n).
+          */
+          reset_dynamic(&rli->curr_group_assigned_parts);
           // reset the B-group and Gtid-group marker
           rli->curr_group_seen_begin= rli->curr_group_seen_gtid= false;
-          if (is_mts_db_partitioned(rli)||
-              (!is_mts_db_partitioned(rli) &&
-             !static_cast<Mts_submode_logical_clock*>
-                (rli->current_mts_submode)->defer_new_group))
+          if (is_mts_db_partitioned(rli) ||
+              !static_cast<Mts_submode_logical_clock*>
+                (rli->current_mts_submode)->defer_new_group)
             rli->last_assigned_worker= NULL;
         }
         /* 
@@ -293,13 +293,14 @@ void CanonicalizeUrl(const GURL& url,
   }
 }
 
-void GenerateHostsToCheck(const GURL& url, std::vector<std::string>* hosts) {
-  hosts->clear();
+namespace {
 
-  std::string canon_host;
-  CanonicalizeUrl(url, &canon_host, NULL, NULL);
+// Fills |hosts| from an already canonicalized host, see GenerateHostsToCheck().
+void GenerateHostsToCheckFromCanonicalHost(const std::string& canon_host,
+                                           std::vector<std::string>* hosts) {
+  hosts->clear();
 
-  const std::string host = canon_host;  // const sidesteps GCC bugs below!
+  const std::string& host = canon_host;  // const sidesteps GCC bugs below!
   if (host.empty())
     return;
 
@@ -330,15 +331,15 @@ void GenerateHostsToCheck(const GURL& url, std::vector<std::string>* hosts) {
   hosts->push_back(host);
 }
 
-void GeneratePathsToCheck(const GURL& url, std::vector<std::string>* paths) {
+// Fills |paths| from an already canonicalized path and query, see
+// GeneratePathsToCheck().
+void GeneratePathsToCheckFromCanonicalPath(const std::string& canon_path,
+                                           const std::string& canon_query,
+                                           std::vector<std::string>* paths) {
   paths->clear();
 
-  std::string canon_path;
-  std::string canon_query;
-  CanonicalizeUrl(url, NULL, &canon_path, &canon_query);
-
-  const std::string path = canon_path;   // const sidesteps GCC bugs below!
-  const std::string query = canon_query;
+  const std::string& path = canon_path;   // const sidesteps GCC bugs below!
+  const std::string& query = canon_query;
   if (path.empty())
     return;
 
@@ -361,21 +362,44 @@ void GeneratePathsToCheck(const GURL& url, std::vector<std::string>* paths) {
     paths->push_back(path + "?" + query);
 }
 
+}  // namespace
+
+void GenerateHostsToCheck(const GURL& url, std::vector<std::string>* hosts) {
+  std::string canon_host;
+  CanonicalizeUrl(url, &canon_host, NULL, NULL);
+  GenerateHostsToCheckFromCanonicalHost(canon_host, hosts);
+}
+
+void GeneratePathsToCheck(const GURL& url, std::vector<std::string>* paths) {
+  std::string canon_path;
+  std::string canon_query;
+  CanonicalizeUrl(url, NULL, &canon_path, &canon_query);
+  GeneratePathsToCheckFromCanonicalPath(canon_path, canon_query, paths);
+}
+
 int CompareFullHashes(const GURL& url,
                       const std::vector<SBFullHashResult>& full_hashes) {
   if (full_hashes.empty())
     return -1;
 
+  // Canonicalize once for both the host and the path expressions.
+  std::string canon_host;
+  std::string canon_path;
+  std::string canon_query;
+  CanonicalizeUrl(url, &canon_host, &canon_path, &canon_query);
+
   std::vector<std::string> hosts, paths;
-  GenerateHostsToCheck(url, &hosts);
-  GeneratePathsToCheck(url, &paths);
+  GenerateHostsToCheckFromCanonicalHost(canon_host, &hosts);
+  GeneratePathsToCheckFromCanonicalPath(canon_path, canon_query, &paths);
 
+  std::string expression;
   for (size_t h = 0; h < hosts.size(); ++h) {
     for (size_t p = 0; p < paths.size(); ++p) {
+      expression.assign(hosts[h]);
+      expression.append(paths[p]);
+
       SBFullHash key;
-      base::SHA256HashString(hosts[h] + paths[p],
-                             key.full_hash,
-                             sizeof(SBFullHash));
+      base::SHA256HashString(expression, key.full_hash, sizeof(SBFullHash));
 
       for (size_t i = 0; i < full_hashes.size(); ++i) {
         if (key == full_hashes[i].hash)
@@ -76,6 +76,11 @@ const uint32 kMaxFilePathLength = PATH_MAX - 1;
 // should be "(9998)", so the value is 6.
 const uint32 kMaxFileOrdinalNumberPartLength = 6;
 
+// Maximum number of sub-resources saved at the same time when saving a
+// complete HTML page. Saving them one by one leaves media-rich pages waiting
+// on a single request.
+const int kMaxConcurrentSubResourceSaves = 6;
+
 // Strip current ordinal number, if any. Should only be used on pure
 // file names, i.e. those stripped of their extensions.
 // TODO(estade): improve this to not choke on alternate encodings.
@@ -925,7 +930,14 @@ void SavePackage::DoSavingProcess() {
       DCHECK(wait_state_ == NET_FILES);
       save_item = waiting_item_queue_.front();
       if (save_item->save_source() != SaveFileCreateInfo::SAVE_FILE_FROM_DOM) {
-        SaveNextFile(false);
+        // Keep up to kMaxConcurrentSubResourceSaves sub-resources in flight.
+        // The HTML frames queued after them still wait for all of them.
+        do {
+          SaveNextFile(false);
+        } while (waiting_item_queue_.size() &&
+                 waiting_item_queue_.front()->save_source() !=
+                     SaveFileCreateInfo::SAVE_FILE_FROM_DOM &&
+                 in_process_count() < kMaxConcurrentSubResourceSaves);
       } else if (!in_process_count()) {
         // If there is no in-process SaveItem, it means all sub-resources
         // have been processed. Now we need to start serializing HTML DOM
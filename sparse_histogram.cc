@@ -129,10 +129,15 @@ std::unique_ptr<HistogramSamples> SparseHistogram::SnapshotDelta() {
   DCHECK(!final_delta_created_);
 
   std::unique_ptr<SampleMap> snapshot(new SampleMap(name_hash()));
-  base::AutoLock auto_lock(lock_);
-  snapshot->Add(*samples_);
+  {
+    base::AutoLock auto_lock(lock_);
+    snapshot->Add(*samples_);
+  }
 
-  // Subtract what was previously logged and update that information.
+  // Subtract what was previously logged and update that information. Only
+  // the snapshotting thread touches |logged_samples_|, so this runs without
+  // holding up threads that are recording samples; for persistent
+  // histograms updating it can mean allocating new sample records.
   snapshot->Subtract(*logged_samples_);
   logged_samples_->Add(*snapshot);
   return std::move(snapshot);
@@ -143,8 +148,10 @@ std::unique_ptr<HistogramSamples> SparseHistogram::SnapshotFinalDelta() const {
   final_delta_created_ = true;
 
   std::unique_ptr<SampleMap> snapshot(new SampleMap(name_hash()));
-  base::AutoLock auto_lock(lock_);
-  snapshot->Add(*samples_);
+  {
+    base::AutoLock auto_lock(lock_);
+    snapshot->Add(*samples_);
+  }
 
   // Subtract what was previously logged and then return.
   snapshot->Subtract(*logged_samples_);
@@ -99,10 +99,14 @@ void SpdyWriteQueue::RemovePendingWritesForStream(
   // SpdyBuffer::~SpdyBuffer() can result in callbacks into SpdyWriteQueue.
   std::vector<SpdyBufferProducer*> erased_buffer_producers;
 
-  // Do the actual deletion and removal, preserving FIFO-ness.
+  // Do the actual deletion and removal, preserving FIFO-ness. Writes ahead
+  // of the stream's first one stay where they are, so start compacting there
+  // instead of copying the whole queue onto itself.
   std::deque<PendingWrite>* queue = &queue_[priority];
   std::deque<PendingWrite>::iterator out_it = queue->begin();
-  for (std::deque<PendingWrite>::const_iterator it = queue->begin();
+  while (out_it != queue->end() && out_it->stream.get() != stream.get())
+    ++out_it;
+  for (std::deque<PendingWrite>::const_iterator it = out_it;
        it != queue->end(); ++it) {
     if (it->stream.get() == stream.get()) {
       erased_buffer_producers.push_back(it->frame_producer);
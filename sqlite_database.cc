@@ -107,6 +107,16 @@ bool SQLiteDatabase::Open(const String& filename) {
   if (!SQLiteStatement(*this, "PRAGMA foreign_keys = OFF;").ExecuteCommand())
     DLOG(ERROR) << "SQLite database could not turn off foreign_keys";
 
+  // The default DELETE journal mode creates and unlinks the rollback journal
+  // for every transaction, which costs an extra file creation and directory
+  // sync per commit. TRUNCATE keeps the same on-disk format and durability
+  // while reusing the journal file between transactions.
+  SQLiteStatement journal_mode(*this, "PRAGMA journal_mode = TRUNCATE;");
+  if (journal_mode.Prepare() != kSQLResultOk ||
+      journal_mode.Step() != kSQLResultRow) {
+    DLOG(ERROR) << "SQLite database could not set journal_mode to truncate";
+  }
+
   return IsOpen();
 }
 
@@ -926,6 +926,7 @@ int SSLClientSocketImpl::Init() {
 
   ScopedSSL_SESSION session =
       context->session_cache()->Lookup(GetSessionCacheKey());
+  UMA_HISTOGRAM_BOOLEAN("Net.SSLSessionCacheHit", !!session);
   if (session)
     SSL_set_session(ssl_, session.get());
 
@@ -1217,6 +1218,10 @@ int SSLClientSocketImpl::DoHandshakeComplete(int result) {
   RecordChannelIDSupport(channel_id_service_, channel_id_sent_,
                          ssl_config_.channel_id_enabled);
 
+  // Together with Net.SSLSessionCacheHit this shows how often an offered
+  // session is actually accepted by the server.
+  UMA_HISTOGRAM_BOOLEAN("Net.SSLSessionResumed", !!SSL_session_reused(ssl_));
+
   // Only record OCSP histograms if OCSP was requested.
   if (ssl_config_.signed_cert_timestamps_enabled ||
       cert_verifier_->SupportsOCSPStapling()) {
@@ -4,6 +4,8 @@
 
 #include "base/string_split.h"
 
+#include <algorithm>
+
 #include "base/logging.h"
 #include "base/string_util.h"
 #include "base/third_party/icu/icu_utf.h"
@@ -16,20 +18,20 @@ static void SplitStringT(const STR& str,
                          const typename STR::value_type s,
                          bool trim_whitespace,
                          std::vector<STR>* r) {
+  // Size the result up front so that growing it doesn't copy every piece
+  // already split off.
+  r->reserve(r->size() + std::count(str.begin(), str.end(), s) + 1);
+
   size_t last = 0;
   size_t i;
   size_t c = str.size();
   for (i = 0; i <= c; ++i) {
     if (i == c || str[i] == s) {
-      size_t len = i - last;
-      STR tmp = str.substr(last, len);
-      if (trim_whitespace) {
-        STR t_tmp;
-        TrimWhitespace(tmp, TRIM_ALL, &t_tmp);
-        r->push_back(t_tmp);
-      } else {
-        r->push_back(tmp);
-      }
+      // Build each piece in place rather than through temporaries.
+      r->push_back(STR());
+      r->back().assign(str, last, i - last);
+      if (trim_whitespace)
+        TrimWhitespace(r->back(), TRIM_ALL, &r->back());
       last = i + 1;
     }
   }
@@ -65,17 +67,16 @@ bool SplitStringIntoKeyValues(
   key->assign(line, 0, end_key_pos);
 
   // Find the values string.
-  std::string remains(line, end_key_pos, line.size() - end_key_pos);
-  size_t begin_values_pos = remains.find_first_not_of(key_value_delimiter);
+  size_t begin_values_pos =
+      line.find_first_not_of(key_value_delimiter, end_key_pos);
   if (begin_values_pos == std::string::npos) {
     DVLOG(1) << "cannot parse value from line: " << line;
     return false;   // no value
   }
-  std::string values_string(remains, begin_values_pos,
-                            remains.size() - begin_values_pos);
 
   // Construct the values vector.
-  values->push_back(values_string);
+  values->push_back(std::string());
+  values->back().assign(line, begin_values_pos, std::string::npos);
   return true;
 }
 
@@ -20,6 +20,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include "third_party/sfntly/src/sfntly/glyph_table.h"
 #include "third_party/sfntly/src/sfntly/loca_table.h"
@@ -204,55 +205,61 @@ bool SubsetterImpl::ResolveCompositeGlyphs(const unsigned int* glyph_ids,
     return false;
   }
 
-  // Sort and uniquify glyph ids.
-  IntegerSet glyph_id_remaining;
-  glyph_id_remaining.insert(0);  // Always include glyph id 0.
+  // |queued| marks the glyph ids that have already been put on the work list,
+  // so that every glyph is fetched and inspected at most once no matter how
+  // many composite glyphs refer to it.
+  const int32_t num_glyphs = loca_table->NumGlyphs();
+  std::vector<bool> queued(num_glyphs > 0 ? num_glyphs : 0, false);
+  std::vector<int32_t> glyph_id_remaining;
+  glyph_id_remaining.reserve(glyph_count + 1);
+  if (num_glyphs > 0) {
+    queued[0] = true;
+    glyph_id_remaining.push_back(0);  // Always include glyph id 0.
+  }
   for (size_t i = 0; i < glyph_count; ++i) {
-    glyph_id_remaining.insert(glyph_ids[i]);
+    int32_t glyph_id = glyph_ids[i];
+    if (glyph_id < 0 || glyph_id >= num_glyphs || queued[glyph_id]) {
+      // Invalid or duplicate glyph id, ignore.
+      continue;
+    }
+    queued[glyph_id] = true;
+    glyph_id_remaining.push_back(glyph_id);
   }
 
   // Identify if any given glyph id maps to a composite glyph.  If so, include
   // the glyphs referenced by that composite glyph.
   while (!glyph_id_remaining.empty()) {
-    IntegerSet comp_glyph_id;
-    for (IntegerSet::iterator i = glyph_id_remaining.begin(),
-                              e = glyph_id_remaining.end(); i != e; ++i) {
-      if (*i < 0 || *i >= loca_table->NumGlyphs()) {
-        // Invalid glyph id, ignore.
-        continue;
-      }
+    int32_t glyph_id = glyph_id_remaining.back();
+    glyph_id_remaining.pop_back();
 
-      int32_t length = loca_table->GlyphLength(*i);
-      if (length == 0) {
-        // Empty glyph, ignore.
-        continue;
-      }
-      int32_t offset = loca_table->GlyphOffset(*i);
+    int32_t length = loca_table->GlyphLength(glyph_id);
+    if (length == 0) {
+      // Empty glyph, ignore.
+      continue;
+    }
+    int32_t offset = loca_table->GlyphOffset(glyph_id);
 
-      GlyphPtr glyph;
-      glyph.Attach(glyph_table->GetGlyph(offset, length));
-      if (glyph == NULL) {
-        // Error finding glyph, ignore.
-        continue;
-      }
+    GlyphPtr glyph;
+    glyph.Attach(glyph_table->GetGlyph(offset, length));
+    if (glyph == NULL) {
+      // Error finding glyph, ignore.
+      continue;
+    }
 
-      if (glyph->GlyphType() == GlyphType::kComposite) {
-        Ptr<GlyphTable::CompositeGlyph> comp_glyph =
-            down_cast<GlyphTable::CompositeGlyph*>(glyph.p_);
-        for (int32_t j = 0; j < comp_glyph->NumGlyphs(); ++j) {
-          int32_t glyph_id = comp_glyph->GlyphIndex(j);
-          if (glyph_id_processed->find(glyph_id) == glyph_id_processed->end() &&
-              glyph_id_remaining.find(glyph_id) == glyph_id_remaining.end()) {
-            comp_glyph_id.insert(comp_glyph->GlyphIndex(j));
-          }
+    if (glyph->GlyphType() == GlyphType::kComposite) {
+      Ptr<GlyphTable::CompositeGlyph> comp_glyph =
+          down_cast<GlyphTable::CompositeGlyph*>(glyph.p_);
+      for (int32_t j = 0; j < comp_glyph->NumGlyphs(); ++j) {
+        int32_t comp_glyph_id = comp_glyph->GlyphIndex(j);
+        if (comp_glyph_id >= 0 && comp_glyph_id < num_glyphs &&
+            !queued[comp_glyph_id]) {
+          queued[comp_glyph_id] = true;
+          glyph_id_remaining.push_back(comp_glyph_id);
         }
       }
-
-      glyph_id_processed->insert(*i);
     }
 
-    glyph_id_remaining.clear();
-    glyph_id_remaining = comp_glyph_id;
+    glyph_id_processed->insert(glyph_id);
   }
 
   return true;
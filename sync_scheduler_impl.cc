@@ -13,6 +13,7 @@
 #include "base/location.h"
 #include "base/logging.h"
 #include "base/message_loop.h"
+#include "base/metrics/histogram.h"
 #include "sync/engine/backoff_delay_provider.h"
 #include "sync/engine/syncer.h"
 #include "sync/engine/throttled_data_type_tracker.h"
@@ -790,15 +791,26 @@ void SyncSchedulerImpl::DoSyncSessionJob(const SyncSessionJob& job) {
   SetSyncerStepsForPurpose(job.purpose, &begin, &end);
 
   bool has_more_to_sync = true;
+  int cycle_count = 0;
+  TimeTicks sync_start = TimeTicks::Now();
   while (ShouldRunJob(job) && has_more_to_sync) {
     SDVLOG(2) << "Calling SyncShare.";
     // Synchronously perform the sync session from this thread.
     syncer_->SyncShare(job.session.get(), begin, end);
+    ++cycle_count;
     has_more_to_sync = job.session->HasMoreToSync();
     if (has_more_to_sync)
       job.session->PrepareForAnotherSyncCycle();
   }
-  SDVLOG(2) << "Done SyncShare looping.";
+  SDVLOG(2) << "Done SyncShare looping after " << cycle_count << " cycles.";
+
+  // Track how many cycles a nudge needs and how long it keeps the sync thread
+  // busy, so that the effect of coalescing bulk changes can be measured.
+  if (job.purpose == SyncSessionJob::NUDGE && cycle_count > 0) {
+    UMA_HISTOGRAM_COUNTS_100("Sync.NudgeJobCycleCount", cycle_count);
+    UMA_HISTOGRAM_TIMES("Sync.NudgeJobDuration",
+                        TimeTicks::Now() - sync_start);
+  }
 
   FinishSyncSessionJob(job);
 }
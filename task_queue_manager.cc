@@ -185,12 +185,14 @@ bool TaskQueue::PostDelayedTaskImpl(const tracked_objects::Location& from_here,
                                     const base::Closure& task,
                                     base::TimeDelta delay,
                                     TaskType task_type) {
+  // Build the task before taking |lock_| so that posting threads hold it for
+  // as short a time as possible.
+  base::PendingTask pending_task(from_here, task, base::TimeTicks(),
+                                 task_type != TaskType::NON_NESTABLE);
   base::AutoLock lock(lock_);
   if (!task_queue_manager_)
     return false;
 
-  base::PendingTask pending_task(from_here, task, base::TimeTicks(),
-                                 task_type != TaskType::NON_NESTABLE);
   task_queue_manager_->DidQueueTask(&pending_task);
 
   if (delay > base::TimeDelta()) {
@@ -387,9 +389,13 @@ void TaskQueue::PumpQueueLocked() {
     LazyNow lazy_now(task_queue_manager_);
     MoveReadyDelayedTasksToIncomingQueueLocked(&lazy_now);
   }
-  while (!incoming_queue_.empty()) {
-    work_queue_.push(incoming_queue_.front());
-    incoming_queue_.pop();
+  if (work_queue_.empty()) {
+    work_queue_.Swap(&incoming_queue_);
+  } else {
+    while (!incoming_queue_.empty()) {
+      work_queue_.push(incoming_queue_.front());
+      incoming_queue_.pop();
+    }
   }
   if (!work_queue_.empty())
     task_queue_manager_->MaybePostDoWorkOnMainRunner();
@@ -381,6 +381,26 @@ char ByteVector::at(uint index) const
 
 int ByteVector::find(const ByteVector &pattern, uint offset, int byteAlign) const
 {
+  // Unaligned searches are by far the most common (header and frame ID
+  // scans), and the data is contiguous, so let memchr() skip ahead to each
+  // occurrence of the first byte and only compare the rest there.
+
+  if(byteAlign == 1 && pattern.size() > 0 && pattern.size() <= size() && offset < size()) {
+    const char *begin = data();
+    const char *end = begin + size() - pattern.size() + 1;
+    const char *patternData = pattern.data();
+    const uint patternSize = pattern.size();
+
+    for(const char *it = begin + offset; it < end; ++it) {
+      it = static_cast<const char *>(::memchr(it, patternData[0], end - it));
+      if(!it)
+        return -1;
+      if(::memcmp(it + 1, patternData + 1, patternSize - 1) == 0)
+        return it - begin;
+    }
+    return -1;
+  }
+
   return vectorFind<ByteVector>(*this, pattern, offset, byteAlign);
 }
 
@@ -72,29 +72,6 @@ bool TemplateURLsHaveSamePrefs(const TemplateURL* url1,
 
 }  // namespace
 
-
-class TemplateURLService::LessWithPrefix {
- public:
-  // We want to find the set of keywords that begin with a prefix.  The STL
-  // algorithms will return the set of elements that are "equal to" the
-  // prefix, where "equal(x, y)" means "!(cmp(x, y) || cmp(y, x))".  When
-  // cmp() is the typical std::less<>, this results in lexicographic equality;
-  // we need to extend this to mark a prefix as "not less than" a keyword it
-  // begins, which will cause the desired elements to be considered "equal to"
-  // the prefix.  Note: this is still a strict weak ordering, as required by
-  // equal_range() (though I will not prove that here).
-  //
-  // Unfortunately the calling convention is not "prefix and element" but
-  // rather "two elements", so we pass the prefix as a fake "element" which has
-  // a NULL KeywordDataElement pointer.
-  bool operator()(const KeywordToTemplateMap::value_type& elem1,
-                  const KeywordToTemplateMap::value_type& elem2) const {
-    return (elem1.second == NULL) ?
-        (elem2.first.compare(0, elem1.first.length(), elem1.first) > 0) :
-        (elem1.first < elem2.first);
-  }
-};
-
 TemplateURLService::TemplateURLService(Profile* profile)
     : profile_(profile),
       loaded_(false),
@@ -248,28 +225,14 @@ void TemplateURLService::FindMatchingKeywords(
   DCHECK(matches != NULL);
   DCHECK(matches->empty());  // The code for exact matches assumes this.
 
-  // Visual Studio 2010 has problems converting NULL to the null pointer for
-  // std::pair.  See http://connect.microsoft.com/VisualStudio/feedback/details/520043/error-converting-from-null-to-a-pointer-type-in-std-pair
-  // It will work if we pass nullptr.
-#if defined(_MSC_VER) && _MSC_VER >= 1600
-  const TemplateURL* null_url = nullptr;
-#else
-  const TemplateURL* null_url = NULL;
-#endif
-
-  // Find matching keyword range.  Searches the element map for keywords
-  // beginning with |prefix| and stores the endpoints of the resulting set in
-  // |match_range|.
-  const std::pair<KeywordToTemplateMap::const_iterator,
-                  KeywordToTemplateMap::const_iterator> match_range(
-      std::equal_range(
-          keyword_to_template_map_.begin(), keyword_to_template_map_.end(),
-          KeywordToTemplateMap::value_type(prefix, null_url),
-          LessWithPrefix()));
-
-  // Return vector of matching keywords.
-  for (KeywordToTemplateMap::const_iterator i(match_range.first);
-       i != match_range.second; ++i) {
+  // Keywords beginning with |prefix| are contiguous in the map, starting at
+  // the first keyword that is not less than |prefix|.  Walking forward from
+  // lower_bound() only visits the matches; a binary search algorithm over the
+  // map's bidirectional iterators would step through the whole map.
+  for (KeywordToTemplateMap::const_iterator i(
+           keyword_to_template_map_.lower_bound(prefix));
+       i != keyword_to_template_map_.end() &&
+       i->first.compare(0, prefix.length(), prefix) == 0; ++i) {
     DCHECK(i->second->url());
     if (!support_replacement_only || i->second->url()->SupportsReplacement())
       matches->push_back(i->first);
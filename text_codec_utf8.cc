@@ -28,11 +28,16 @@
 #include <memory>
 #include "base/memory/ptr_util.h"
 #include "base/numerics/checked_math.h"
+#include "build/build_config.h"
 #include "third_party/blink/renderer/platform/wtf/text/character_names.h"
 #include "third_party/blink/renderer/platform/wtf/text/cstring.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_buffer.h"
 #include "third_party/blink/renderer/platform/wtf/text/text_codec_ascii_fast_path.h"
 
+#if defined(ARCH_CPU_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
 namespace WTF {
 
 // We'll use nonCharacter* constants to signal invalid utf-8.
@@ -45,6 +50,49 @@ bool IsNonCharacter(int character) {
   return character >= kNonCharacter3 && character <= kNonCharacter1;
 }
 
+// Copies 16-byte blocks of ASCII from |source| to |destination| until fewer
+// than 16 bytes remain or a block contains a non-ASCII byte, advancing both
+// pointers past what was copied. Without SSE2 this is a no-op and the
+// machine word loops below do all the work.
+#if defined(ARCH_CPU_X86_FAMILY)
+static inline void CopyASCIIBlocks(const uint8_t*& source,
+                                   const uint8_t* end,
+                                   LChar*& destination) {
+  while (end - source >= 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+    if (_mm_movemask_epi8(chunk))
+      return;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), chunk);
+    source += 16;
+    destination += 16;
+  }
+}
+
+static inline void CopyASCIIBlocks(const uint8_t*& source,
+                                   const uint8_t* end,
+                                   UChar*& destination) {
+  const __m128i zero = _mm_setzero_si128();
+  while (end - source >= 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+    if (_mm_movemask_epi8(chunk))
+      return;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination),
+                     _mm_unpacklo_epi8(chunk, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 8),
+                     _mm_unpackhi_epi8(chunk, zero));
+    source += 16;
+    destination += 16;
+  }
+}
+#else
+template <typename CharType>
+static inline void CopyASCIIBlocks(const uint8_t*&,
+                                   const uint8_t*,
+                                   CharType*&) {}
+#endif
+
 std::unique_ptr<TextCodec> TextCodecUTF8::Create(const TextEncoding&,
                                                  const void*) {
   return base::WrapUnique(new TextCodecUTF8());
@@ -325,6 +373,11 @@ String TextCodecUTF8::Decode(const char* bytes,
     while (source < end) {
       if (IsASCII(*source)) {
         // Fast path for ASCII. Most UTF-8 text will be ASCII.
+        CopyASCIIBlocks(source, end, destination);
+        if (source == end)
+          break;
+        if (!IsASCII(*source))
+          continue;
         if (IsAlignedToMachineWord(source)) {
           while (source < aligned_end) {
             MachineWord chunk =
@@ -407,6 +460,11 @@ upConvertTo16Bit:
     while (source < end) {
       if (IsASCII(*source)) {
         // Fast path for ASCII. Most UTF-8 text will be ASCII.
+        CopyASCIIBlocks(source, end, destination16);
+        if (source == end)
+          break;
+        if (!IsASCII(*source))
+          continue;
         if (IsAlignedToMachineWord(source)) {
           while (source < aligned_end) {
             MachineWord chunk =
@@ -30,6 +30,7 @@
 
 #include "third_party/blink/renderer/platform/wtf/text/text_codec_utf8.h"
 
+#include <string.h>
 #include <limits>
 #include <memory>
 #include "testing/gtest/include/gtest/gtest.h"
@@ -78,6 +79,36 @@ TEST(TextCodecUTF8, DecodeChineseCharacters) {
   EXPECT_EQ(0x5b57U, result[1]);
 }
 
+TEST(TextCodecUTF8, DecodeLongAsciiMixedWithNonAscii) {
+  TextEncoding encoding("UTF-8");
+
+  // Place multi-byte sequences on either side of several block boundaries
+  // so that both the 8-bit and the 16-bit output paths copy long ASCII runs.
+  const struct {
+    const char* input;
+    wtf_size_t expected_length;
+    UChar expected_non_ascii;
+  } kTestCases[] = {
+      {"0123456789abcdefghijklmnopqrstu\xc3\xa9vwxyz0123456789ABCDEFGHIJ", 57,
+       0xe9},
+      {"0123456789abcdefghijklmnopqrstu\xe6\xbc\xa2vwxyz0123456789ABCDEFGHIJ",
+       57, 0x6f22},
+  };
+
+  for (const auto& test_case : kTestCases) {
+    std::unique_ptr<TextCodec> codec(NewTextCodec(encoding));
+    bool saw_error = false;
+    const String& result = codec->Decode(
+        test_case.input, static_cast<wtf_size_t>(strlen(test_case.input)),
+        FlushBehavior::kDataEOF, false, saw_error);
+    EXPECT_FALSE(saw_error);
+    ASSERT_EQ(test_case.expected_length, result.length());
+    EXPECT_EQ(String("0123456789abcdefghijklmnopqrstu"), result.Left(31));
+    EXPECT_EQ(test_case.expected_non_ascii, result[31]);
+    EXPECT_EQ(String("vwxyz0123456789ABCDEFGHIJ"), result.Substring(32));
+  }
+}
+
 TEST(TextCodecUTF8, Decode0xFF) {
   TextEncoding encoding("UTF-8");
   std::unique_ptr<TextCodec> codec(NewTextCodec(encoding));
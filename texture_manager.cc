@@ -267,10 +267,10 @@ void TextureManager::TextureInfo::SetLevelCleared(GLenum target, GLint level) {
             level_infos_[GLTargetToFaceIndex(target)].size());
   TextureInfo::LevelInfo& info =
       level_infos_[GLTargetToFaceIndex(target)][level];
-  if (!info.cleared) {
-    DCHECK_NE(0, num_uncleared_mips_);
-    --num_uncleared_mips_;
-  }
+  if (info.cleared)
+    return;
+  DCHECK_NE(0, num_uncleared_mips_);
+  --num_uncleared_mips_;
   info.cleared = true;
   UpdateCleared();
 }
@@ -280,6 +280,12 @@ void TextureManager::TextureInfo::UpdateCleared() {
     return;
   }
 
+  // With no uncleared level anywhere there is nothing to scan for.
+  if (num_uncleared_mips_ == 0) {
+    cleared_ = true;
+    return;
+  }
+
   const TextureInfo::LevelInfo& first_face = level_infos_[0][0];
   int levels_needed = ComputeMipMapCount(
       first_face.width, first_face.height, first_face.depth);
@@ -4,6 +4,8 @@
 
 #include "components/history/core/browser/top_sites_cache.h"
 
+#include <utility>
+
 #include "base/logging.h"
 #include "base/memory/ref_counted_memory.h"
 
@@ -40,13 +42,12 @@ void TopSitesCache::SetThumbnails(const URLToImagesMap& images) {
 }
 
 void TopSitesCache::ClearUnreferencedThumbnails() {
-  URLToImagesMap images_to_keep;
-  for (const std::pair<GURL, Images>& entry : images_) {
-    if (IsKnownURL(entry.first)) {
-      images_to_keep.insert(entry);
-    }
+  for (URLToImagesMap::iterator it = images_.begin(); it != images_.end();) {
+    if (IsKnownURL(it->first))
+      ++it;
+    else
+      images_.erase(it++);
   }
-  images_ = std::move(images_to_keep);
 }
 
 Images* TopSitesCache::GetImage(const GURL& url) {
@@ -168,13 +169,12 @@ void TopSitesCache::StoreRedirectChain(const RedirectList& redirects,
 
   // Map all the redirected URLs to the destination.
   for (size_t i = 0; i < redirects.size(); i++) {
-    // If this redirect is already known, don't replace it with a new one.
-    if (!IsKnownURL(redirects[i])) {
-      CanonicalURLEntry entry;
-      entry.first = &(top_sites_[destination]);
-      entry.second = i;
-      canonical_urls_[entry] = destination;
-    }
+    // If this redirect is already known, don't replace it with a new one;
+    // insert() leaves an existing entry untouched, so a single lookup does.
+    CanonicalURLEntry entry;
+    entry.first = &(top_sites_[destination]);
+    entry.second = i;
+    canonical_urls_.insert(std::make_pair(entry, destination));
   }
 }
 
@@ -246,7 +246,7 @@ void TraceEvent::AppendValueAsJSON(unsigned char type,
       } else {
         real = "\"Infinity\"";
       }
-      StringAppendF(out, "%s", real.c_str());
+      *out += real;
       break;
     }
     case TRACE_VALUE_TYPE_POINTER:
@@ -337,7 +337,7 @@ void TraceEvent::AppendAsJSON(
 
   // Output async tts marker field if flag is set.
   if (flags_ & TRACE_EVENT_FLAG_ASYNC_TTS) {
-    StringAppendF(out, ", \"use_async_tts\":1");
+    *out += ", \"use_async_tts\":1";
   }
 
   // If id_ is set, print it out as a hex string so we don't loose any
@@ -346,7 +346,7 @@ void TraceEvent::AppendAsJSON(
     StringAppendF(out, ",\"id\":\"0x%" PRIx64 "\"", static_cast<uint64>(id_));
 
   if (flags_ & TRACE_EVENT_FLAG_BIND_TO_ENCLOSING)
-    StringAppendF(out, ",\"bp\":\"e\"");
+    *out += ",\"bp\":\"e\"";
 
   if ((flags_ & TRACE_EVENT_FLAG_FLOW_OUT) ||
       (flags_ & TRACE_EVENT_FLAG_FLOW_IN)) {
@@ -354,9 +354,9 @@ void TraceEvent::AppendAsJSON(
                   static_cast<uint64>(bind_id_));
   }
   if (flags_ & TRACE_EVENT_FLAG_FLOW_IN)
-    StringAppendF(out, ",\"flow_in\":true");
+    *out += ",\"flow_in\":true";
   if (flags_ & TRACE_EVENT_FLAG_FLOW_OUT)
-    StringAppendF(out, ",\"flow_out\":true");
+    *out += ",\"flow_out\":true";
 
   // Similar to id_, print the context_id as hex if present.
   if (flags_ & TRACE_EVENT_FLAG_HAS_CONTEXT_ID)
@@ -379,7 +379,9 @@ void TraceEvent::AppendAsJSON(
         scope = TRACE_EVENT_SCOPE_NAME_THREAD;
         break;
     }
-    StringAppendF(out, ",\"s\":\"%c\"", scope);
+    *out += ",\"s\":\"";
+    *out += scope;
+    *out += "\"";
   }
 
   *out += "}";
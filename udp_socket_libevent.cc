@@ -17,6 +17,7 @@
 #include "base/message_loop/message_loop.h"
 #include "base/metrics/sparse_histogram.h"
 #include "base/metrics/stats_counters.h"
+#include "base/metrics/stats_table.h"
 #include "base/posix/eintr_wrapper.h"
 #include "base/rand_util.h"
 #include "net/base/io_buffer.h"
@@ -410,8 +411,11 @@ void UDPSocketLibevent::LogRead(int result,
             is_address_valid ? &address : NULL));
   }
 
-  base::StatsCounter read_bytes("udp.read_bytes");
-  read_bytes.Add(result);
+  // Reads happen once per datagram; don't set up a counter nobody records.
+  if (base::StatsTable::current()) {
+    base::StatsCounter read_bytes("udp.read_bytes");
+    read_bytes.Add(result);
+  }
 }
 
 int UDPSocketLibevent::CreateSocket(int addr_family) {
@@ -454,8 +458,10 @@ void UDPSocketLibevent::LogWrite(int result,
         CreateNetLogUDPDataTranferCallback(result, bytes, address));
   }
 
-  base::StatsCounter write_bytes("udp.write_bytes");
-  write_bytes.Add(result);
+  if (base::StatsTable::current()) {
+    base::StatsCounter write_bytes("udp.write_bytes");
+    write_bytes.Add(result);
+  }
 }
 
 int UDPSocketLibevent::InternalRecvFrom(IOBuffer* buf, int buf_len,
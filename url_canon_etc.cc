@@ -244,6 +244,23 @@ bool DoPort(const CHAR* spec,
   return true;
 }
 
+// Appends the run of plain ASCII characters in [begin, end) of |spec|. 8-bit
+// input is already in output form and can be copied in one go.
+inline void AppendASCIIRun(const char* spec,
+                           int begin,
+                           int end,
+                           CanonOutput* output) {
+  output->Append(&spec[begin], end - begin);
+}
+
+inline void AppendASCIIRun(const base::char16* spec,
+                           int begin,
+                           int end,
+                           CanonOutput* output) {
+  for (int i = begin; i < end; i++)
+    output->push_back(static_cast<char>(spec[i]));
+}
+
 template<typename CHAR, typename UCHAR>
 void DoCanonicalizeRef(const CHAR* spec,
                        const Component& ref,
@@ -272,8 +289,14 @@ void DoCanonicalizeRef(const CHAR* spec,
       // shouldn't be using control characters in their anchor names.
       AppendEscapedChar(static_cast<unsigned char>(spec[i]), output);
     } else if (static_cast<UCHAR>(spec[i]) < 0x80) {
-      // Normal ASCII characters are just appended.
-      output->push_back(static_cast<char>(spec[i]));
+      // Normal ASCII characters are just appended. Most refs are entirely
+      // made of them, so find the end of the run and append it as a block.
+      int run_end = i + 1;
+      while (run_end < end && static_cast<UCHAR>(spec[run_end]) >= 0x20 &&
+             static_cast<UCHAR>(spec[run_end]) < 0x80)
+        run_end++;
+      AppendASCIIRun(spec, i, run_end, output);
+      i = run_end - 1;
     } else {
       AppendUTF8EscapedChar(spec, &i, end, output);
     }
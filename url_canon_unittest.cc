@@ -1291,6 +1291,9 @@ TEST(URLCanonTest, Ref) {
       // Refs can have # signs and we should preserve them.
       {"asdf#qwer", L"asdf#qwer", "#asdf#qwer", Component(1, 9), true},
       {"#asdf", L"#asdf", "##asdf", Component(1, 5), true},
+      // Runs of plain characters around escaped ones are copied unchanged.
+      {"abc\x01" "def\x7fgh", L"abc\x01" L"def\x7fgh", "#abc%01def\x7fgh",
+       Component(1, 12), true},
   };
 
   for (size_t i = 0; i < arraysize(ref_cases); i++) {
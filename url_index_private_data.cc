@@ -9,6 +9,7 @@
 #include <iterator>
 #include <limits>
 #include <numeric>
+#include <set>
 #include <vector>
 
 #include "base/basictypes.h"
@@ -74,6 +75,30 @@ bool LengthGreater(const string16& string_a, const string16& string_b) {
   return string_a.length() > string_b.length();
 }
 
+// Intersects |target| with |source|, leaving the result in |target|. When
+// |target| is the smaller set, which is the common case once the first few
+// terms have narrowed the candidates, its members are probed against |source|
+// and the misses erased, rather than building a new set node by node from a
+// walk over both.
+template <typename T>
+void IntersectSetInPlace(std::set<T>* target, const std::set<T>& source) {
+  if (target->size() <= source.size()) {
+    for (typename std::set<T>::iterator iter = target->begin();
+         iter != target->end(); ) {
+      if (source.count(*iter))
+        ++iter;
+      else
+        target->erase(iter++);
+    }
+    return;
+  }
+  std::set<T> intersection;
+  std::set_intersection(target->begin(), target->end(),
+                        source.begin(), source.end(),
+                        std::inserter(intersection, intersection.begin()));
+  target->swap(intersection);
+}
+
 // InMemoryURLIndex's Private Data ---------------------------------------------
 
 URLIndexPrivateData::URLIndexPrivateData()
@@ -171,10 +196,10 @@ void URLIndexPrivateData::AddRowWordsToIndex(const URLRow& row,
       word_starts ? &word_starts->url_word_starts_ : NULL);
   String16Set title_words = String16SetFromString16(row.title(),
       word_starts ? &word_starts->title_word_starts_ : NULL);
-  String16Set words;
-  std::set_union(url_words.begin(), url_words.end(),
-                 title_words.begin(), title_words.end(),
-                 std::insert_iterator<String16Set>(words, words.begin()));
+  // Merge the title words into the URL words rather than copying both into a
+  // third set.
+  String16Set& words = url_words;
+  words.insert(title_words.begin(), title_words.end());
   for (String16Set::iterator word_iter = words.begin();
        word_iter != words.end(); ++word_iter)
     AddWordToIndex(*word_iter, history_id);
@@ -212,9 +237,9 @@ void URLIndexPrivateData::AddWordHistory(const string16& term,
   }
   word_map_[term] = word_id;
 
-  HistoryIDSet history_id_set;
+  HistoryIDSet& history_id_set = word_id_history_map_[word_id];
+  history_id_set.clear();
   history_id_set.insert(history_id);
-  word_id_history_map_[word_id] = history_id_set;
   AddToHistoryIDWordMap(history_id, word_id);
 
   // For each character in the newly added word (i.e. a word that is not
@@ -222,18 +247,9 @@ void URLIndexPrivateData::AddWordHistory(const string16& term,
   Char16Set characters = Char16SetFromString16(term);
   for (Char16Set::iterator uni_char_iter = characters.begin();
        uni_char_iter != characters.end(); ++uni_char_iter) {
-    char16 uni_char = *uni_char_iter;
-    CharWordIDMap::iterator char_iter = char_word_map_.find(uni_char);
-    if (char_iter != char_word_map_.end()) {
-      // Update existing entry in the char/word index.
-      WordIDSet& word_id_set(char_iter->second);
-      word_id_set.insert(word_id);
-    } else {
-      // Create a new entry in the char/word index.
-      WordIDSet word_id_set;
-      word_id_set.insert(word_id);
-      char_word_map_[uni_char] = word_id_set;
-    }
+    // Update the existing entry in the char/word index, or create a new one,
+    // in place.
+    char_word_map_[*uni_char_iter].insert(word_id);
   }
 }
 
@@ -563,8 +579,7 @@ HistoryIDSet URLIndexPrivateData::HistoryIDSetFromWords(
   std::sort(words.begin(), words.end(), LengthGreater);
   for (String16Vector::iterator iter = words.begin(); iter != words.end();
        ++iter) {
-    string16 uni_word = *iter;
-    HistoryIDSet term_history_set = HistoryIDsForTerm(uni_word);
+    HistoryIDSet term_history_set = HistoryIDsForTerm(*iter);
     if (term_history_set.empty()) {
       history_id_set.clear();
       break;
@@ -572,12 +587,9 @@ HistoryIDSet URLIndexPrivateData::HistoryIDSetFromWords(
     if (iter == words.begin()) {
       history_id_set.swap(term_history_set);
     } else {
-      HistoryIDSet new_history_id_set;
-      std::set_intersection(history_id_set.begin(), history_id_set.end(),
-                            term_history_set.begin(), term_history_set.end(),
-                            std::inserter(new_history_id_set,
-                                          new_history_id_set.begin()));
-      history_id_set.swap(new_history_id_set);
+      IntersectSetInPlace(&history_id_set, term_history_set);
+      if (history_id_set.empty())
+        break;
     }
   }
   return history_id_set;
@@ -646,16 +658,10 @@ HistoryIDSet URLIndexPrivateData::HistoryIDsForTerm(
         return HistoryIDSet();
       }
       // Or there may not have been a prefix from which to start.
-      if (prefix_chars.empty()) {
+      if (prefix_chars.empty())
         word_id_set.swap(leftover_set);
-      } else {
-        WordIDSet new_word_id_set;
-        std::set_intersection(word_id_set.begin(), word_id_set.end(),
-                              leftover_set.begin(), leftover_set.end(),
-                              std::inserter(new_word_id_set,
-                                            new_word_id_set.begin()));
-        word_id_set.swap(new_word_id_set);
-      }
+      else
+        IntersectSetInPlace(&word_id_set, leftover_set);
     }
 
     // We must filter the word list because the resulting word set surely
@@ -719,12 +725,9 @@ WordIDSet URLIndexPrivateData::WordIDSetForTermChars(
       word_id_set = char_word_id_set;
     } else {
       // Subsequent character results get intersected in.
-      WordIDSet new_word_id_set;
-      std::set_intersection(word_id_set.begin(), word_id_set.end(),
-                            char_word_id_set.begin(), char_word_id_set.end(),
-                            std::inserter(new_word_id_set,
-                                          new_word_id_set.begin()));
-      word_id_set.swap(new_word_id_set);
+      IntersectSetInPlace(&word_id_set, char_word_id_set);
+      if (word_id_set.empty())
+        break;
     }
   }
   return word_id_set;
@@ -339,12 +339,16 @@ bool URLPattern::MatchesURL(const GURL& test) const {
   if (match_all_urls_)
     return true;
 
+  // Check the host and port first; they reject most patterns in a set and,
+  // unlike the path, don't need a string to be built for the comparison.
+  if (!MatchesSecurityOriginHelper(*test_url))
+    return false;
+
   std::string path_for_request = test.PathForRequest();
   if (has_inner_url)
     path_for_request = test_url->path() + path_for_request;
 
-  return MatchesSecurityOriginHelper(*test_url) &&
-         MatchesPath(path_for_request);
+  return MatchesPath(path_for_request);
 }
 
 bool URLPattern::MatchesSecurityOrigin(const GURL& test) const {
@@ -415,8 +419,11 @@ bool URLPattern::MatchesHost(const GURL& test) const {
 bool URLPattern::MatchesPath(const std::string& test) const {
   // Make the behaviour of OverlapsWith consistent with MatchesURL, which is
   // need to match hosted apps on e.g. 'google.com' also run on 'google.com/'.
-  if (test + "/*" == path_escaped_)
+  if (path_escaped_.length() == test.length() + 2 &&
+      path_escaped_.compare(0, test.length(), test) == 0 &&
+      path_escaped_.compare(test.length(), 2, "/*") == 0) {
     return true;
+  }
 
   return MatchPattern(test, path_escaped_);
 }
@@ -505,8 +512,10 @@ bool URLPattern::MatchesSecurityOriginHelper(const GURL& test) const {
   if (scheme_ != url::kFileScheme && !MatchesHost(test))
     return false;
 
-  if (!MatchesPortPattern(base::IntToString(test.EffectiveIntPort())))
+  if (port_ != "*" &&
+      !MatchesPortPattern(base::IntToString(test.EffectiveIntPort()))) {
     return false;
+  }
 
   return true;
 }
@@ -389,11 +389,12 @@ void ClientUsageTracker::UpdateUsageCache(
     const GURL& origin, int64 delta) {
   std::string host = net::GetHostOrSpecFromURL(origin);
   if (cached_hosts_.find(host) != cached_hosts_.end()) {
-    cached_usage_[host][origin] += delta;
+    int64& origin_usage = cached_usage_[host][origin];
+    origin_usage += delta;
     global_usage_ += delta;
     if (global_unlimited_usage_is_valid_ && IsStorageUnlimited(origin))
       global_unlimited_usage_ += delta;
-    DCHECK_GE(cached_usage_[host][origin], 0);
+    DCHECK_GE(origin_usage, 0);
     DCHECK_GE(global_usage_, 0);
     return;
   }
@@ -408,8 +409,15 @@ void ClientUsageTracker::GetCachedHostsUsage(
   DCHECK(host_usage);
   for (HostUsageMap::const_iterator host_iter = cached_usage_.begin();
        host_iter != cached_usage_.end(); host_iter++) {
-    host_usage->operator[](host_iter->first) +=
-        GetCachedHostUsage(host_iter->first);
+    // Sum the origins in place rather than through GetCachedHostUsage(),
+    // which would look the host up again.
+    int64 usage = 0;
+    const UsageMap& origin_map = host_iter->second;
+    for (UsageMap::const_iterator origin_iter = origin_map.begin();
+         origin_iter != origin_map.end(); origin_iter++) {
+      usage += origin_iter->second;
+    }
+    (*host_usage)[host_iter->first] += usage;
   }
 }
 
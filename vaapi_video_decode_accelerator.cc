@@ -366,6 +366,8 @@ void VaapiVideoDecodeAccelerator::TryOutputSurface() {
 
   if (finish_flush_pending_ && pending_output_cbs_.empty())
     FinishFlush();
+
+  TryFinishSurfaceSetChange();
 }
 
 void VaapiVideoDecodeAccelerator::MapAndQueueNewInputBuffer(
@@ -565,11 +567,11 @@ void VaapiVideoDecodeAccelerator::TryFinishSurfaceSetChange() {
     // 1. Not all pending pending output callbacks have been executed yet.
     // Wait for the client to return enough pictures and retry later.
     // 2. The above happened and all surface release callbacks have been posted
-    // as the result, but not all have executed yet. Post ourselves after them
-    // to let them release surfaces.
+    // as the result, but not all have executed yet.
+    // Both TryOutputSurface() and RecycleVASurfaceID() call us again as they
+    // make progress, so there is no need to keep reposting ourselves while
+    // waiting.
     DVLOG(2) << "Awaiting pending output/surface release callbacks to finish";
-    message_loop_->PostTask(FROM_HERE, base::Bind(
-        &VaapiVideoDecodeAccelerator::TryFinishSurfaceSetChange, weak_this_));
     return;
   }
 
@@ -634,10 +636,13 @@ void VaapiVideoDecodeAccelerator::Decode(
 void VaapiVideoDecodeAccelerator::RecycleVASurfaceID(
     VASurfaceID va_surface_id) {
   DCHECK_EQ(message_loop_, base::MessageLoop::current());
-  base::AutoLock auto_lock(lock_);
+  {
+    base::AutoLock auto_lock(lock_);
+    available_va_surfaces_.push_back(va_surface_id);
+    surfaces_available_.Signal();
+  }
 
-  available_va_surfaces_.push_back(va_surface_id);
-  surfaces_available_.Signal();
+  TryFinishSurfaceSetChange();
 }
 
 void VaapiVideoDecodeAccelerator::AssignPictureBuffers(
@@ -813,9 +813,12 @@ DictionaryValue::Iterator::~Iterator() {}
 DictionaryValue* DictionaryValue::DeepCopy() const {
   DictionaryValue* result = new DictionaryValue;
 
+  // Entries are visited in key order, so hinting at the end makes each
+  // insertion constant time instead of a search of the new map.
   for (const auto& current_entry : dictionary_) {
-    result->SetWithoutPathExpansion(current_entry.first,
-                                    current_entry.second->CreateDeepCopy());
+    result->dictionary_.emplace_hint(result->dictionary_.end(),
+                                     current_entry.first,
+                                     current_entry.second->CreateDeepCopy());
   }
 
   return result;
@@ -831,6 +834,9 @@ bool DictionaryValue::Equals(const Value* other) const {
 
   const DictionaryValue* other_dict =
       static_cast<const DictionaryValue*>(other);
+  if (dictionary_.size() != other_dict->dictionary_.size())
+    return false;
+
   Iterator lhs_it(*this);
   Iterator rhs_it(*other_dict);
   while (!lhs_it.IsAtEnd() && !rhs_it.IsAtEnd()) {
@@ -1125,6 +1131,7 @@ bool ListValue::GetAsList(const ListValue** out_value) const {
 ListValue* ListValue::DeepCopy() const {
   ListValue* result = new ListValue;
 
+  result->list_.reserve(list_.size());
   for (const auto& entry : list_)
     result->Append(entry->CreateDeepCopy());
 
@@ -1141,6 +1148,9 @@ bool ListValue::Equals(const Value* other) const {
 
   const ListValue* other_list =
       static_cast<const ListValue*>(other);
+  if (list_.size() != other_list->list_.size())
+    return false;
+
   Storage::const_iterator lhs_it, rhs_it;
   for (lhs_it = begin(), rhs_it = other_list->begin();
        lhs_it != end() && rhs_it != other_list->end();
@@ -1690,9 +1690,16 @@ static void *vdbeSorterFlushThread(void *pCtx){
 /*
 ** Flush the current contents of VdbeSorter.list to a new PMA, possibly
 ** using a background thread.
+**
+** If bFinal is true, this is the last flush before the merge. The caller
+** is about to block in vdbeSorterJoinAll() in that case, so the list is
+** written by the foreground thread rather than by a newly launched
+** background thread. The main thread would otherwise sit idle waiting
+** for the worker, and the cost of creating the thread is saved.
 */
-static int vdbeSorterFlushPMA(VdbeSorter *pSorter){
+static int vdbeSorterFlushPMA(VdbeSorter *pSorter, int bFinal){
 #if SQLITE_MAX_WORKER_THREADS==0
+  UNUSED_PARAMETER(bFinal);
   pSorter->bUsePMA = 1;
   return vdbeSorterListToPMA(&pSorter->aTask[0], &pSorter->list);
 #else
@@ -1713,7 +1720,7 @@ static int vdbeSorterFlushPMA(VdbeSorter *pSorter){
   ** fall back to using the final sub-task. The first (pSorter->nTask-1)
   ** sub-tasks are prefered as they use background threads - the final
   ** sub-task uses the main thread. */
-  for(i=0; i<nWorker; i++){
+  for(i=(bFinal ? nWorker : 0); i<nWorker; i++){
     int iTest = (pSorter->iPrev + i + 1) % nWorker;
     pTask = &pSorter->aTask[iTest];
     if( pTask->bDone ){
@@ -1811,7 +1818,7 @@ int sqlite3VdbeSorterWrite(
       );
     }
     if( bFlush ){
-      rc = vdbeSorterFlushPMA(pSorter);
+      rc = vdbeSorterFlushPMA(pSorter, 0);
       pSorter->list.szPMA = 0;
       pSorter->iMemory = 0;
       assert( rc!=SQLITE_OK || pSorter->list.pList==0 );
@@ -2594,7 +2601,7 @@ int sqlite3VdbeSorterRewind(const VdbeCursor *pCsr, int *pbEof){
   ** creates a new list consisting of a single key immediately afterwards.
   ** So the list is never empty at this point.  */
   assert( pSorter->list.pList );
-  rc = vdbeSorterFlushPMA(pSorter);
+  rc = vdbeSorterFlushPMA(pSorter, 1);
 
   /* Join all threads */
   rc = vdbeSorterJoinAll(pSorter, rc);
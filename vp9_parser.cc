@@ -342,6 +342,13 @@ bool Vp9Parser::ParseUncompressedHeader(Vp9FrameHeader* fhdr) {
     }
   }
 
+  // A truncated frame is usually already exhausted by this point; don't
+  // bother reading the remaining header fields out of a spent reader.
+  if (!reader_.IsValid()) {
+    DVLOG(1) << "parser reads beyond the end of buffer";
+    return false;
+  }
+
   if (fhdr->error_resilient_mode) {
     fhdr->frame_parallel_decoding_mode = true;
   } else {
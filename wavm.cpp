@@ -1,10 +1,17 @@
 #include <inttypes.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "Emscripten/Emscripten.h"
 #include "IR/Module.h"
 #include "IR/Operators.h"
@@ -121,6 +128,142 @@ struct RootResolver : Resolver
 	}
 };
 
+// Identifies the build of the Runtime library, and of the LLVM it is linked with, by the
+// path, size and modification time of the binary that contains Runtime::compileModule.
+// Returns false if that binary can't be identified.
+static bool getRuntimeIdentity(std::string& outIdentity)
+{
+#ifdef _WIN32
+	return false;
+#else
+	Dl_info info;
+	if(!dladdr(reinterpret_cast<void*>(&Runtime::compileModule), &info) || !info.dli_fname)
+	{ return false; }
+
+	struct stat fileStatus;
+	if(stat(info.dli_fname, &fileStatus) != 0) { return false; }
+
+	char sizeAndTime[64];
+	snprintf(sizeAndTime,
+			 sizeof(sizeAndTime),
+			 ":%" PRIu64 ":%" PRIu64,
+			 U64(fileStatus.st_size),
+			 U64(fileStatus.st_mtime));
+	outIdentity = std::string(info.dli_fname) + sizeAndTime;
+	return true;
+#endif
+}
+
+// Returns the 64-bit FNV-1a hash of a file's contents, or false if it can't be read.
+// The runtime identity is mixed in so that object code cached by a different build of the
+// Runtime or LLVM, which may generate incompatible code, is never reused.
+static bool hashFile(const char* filename, const std::string& runtimeIdentity, U64& outHash)
+{
+	FILE* file = fopen(filename, "rb");
+	if(!file) { return false; }
+
+	U64 hash = 14695981039346656037ull;
+	for(char c : runtimeIdentity)
+	{
+		hash ^= U8(c);
+		hash *= 1099511628211ull;
+	}
+	U8 buffer[64 * 1024];
+	size_t numBytes;
+	while((numBytes = fread(buffer, 1, sizeof(buffer), file)) > 0)
+	{
+		for(size_t i = 0; i < numBytes; ++i)
+		{
+			hash ^= buffer[i];
+			hash *= 1099511628211ull;
+		}
+	}
+	const bool succeeded = !ferror(file);
+	fclose(file);
+	outHash = hash;
+	return succeeded;
+}
+
+// Object code cache entries start with this tag and the hash of the module they were
+// compiled from, so a truncated or mismatched entry is detected before it is loaded.
+static const U64 objectCacheTag = 0x314a424f4d564157ull; // "WAVMOBJ1"
+
+static std::string getObjectCachePath(const char* cacheDir, U64 moduleHash)
+{
+	char hashString[17];
+	snprintf(hashString, sizeof(hashString), "%016" PRIx64, moduleHash);
+	return std::string(cacheDir) + "/" + hashString + ".wavmobj";
+}
+
+static bool loadCachedObjectCode(const std::string& path,
+								 U64 moduleHash,
+								 std::vector<U8>& outObjectCode)
+{
+	FILE* file = fopen(path.c_str(), "rb");
+	if(!file) { return false; }
+
+	// Find the file size, so a corrupt object code size falls back to compiling the module.
+	long fileSize = -1;
+	if(fseek(file, 0, SEEK_END) == 0) { fileSize = ftell(file); }
+	if(fileSize < 0 || fseek(file, 0, SEEK_SET) != 0)
+	{
+		fclose(file);
+		return false;
+	}
+
+	bool succeeded = false;
+	U64 header[3];
+	if(fread(header, sizeof(header), 1, file) == 1 && header[0] == objectCacheTag
+	   && header[1] == moduleHash && U64(fileSize) >= sizeof(header)
+	   && header[2] <= U64(fileSize) - sizeof(header))
+	{
+		outObjectCode.resize(header[2]);
+		succeeded = outObjectCode.empty()
+					|| fread(outObjectCode.data(), outObjectCode.size(), 1, file) == 1;
+	}
+	fclose(file);
+	return succeeded;
+}
+
+static void saveCachedObjectCode(const std::string& path,
+								 U64 moduleHash,
+								 const std::vector<U8>& objectCode)
+{
+#ifdef _WIN32
+	// getRuntimeIdentity never succeeds on Windows, so nothing is cached there.
+	(void)path;
+	(void)moduleHash;
+	(void)objectCode;
+#else
+	// Write to a uniquely named temporary file and rename it into place, so concurrent runs
+	// never see a partially written entry.
+	std::string tempPath = path + ".XXXXXX";
+	const int fd = mkstemp(&tempPath[0]);
+	FILE* file = fd == -1 ? nullptr : fdopen(fd, "wb");
+	if(!file)
+	{
+		Log::printf(Log::debug, "Couldn't create object cache entry %s\n", tempPath.c_str());
+		if(fd != -1)
+		{
+			close(fd);
+			remove(tempPath.c_str());
+		}
+		return;
+	}
+
+	const U64 header[3] = {objectCacheTag, moduleHash, U64(objectCode.size())};
+	bool succeeded = fwrite(header, sizeof(header), 1, file) == 1
+					 && (objectCode.empty()
+						 || fwrite(objectCode.data(), objectCode.size(), 1, file) == 1);
+	succeeded = (fclose(file) == 0) && succeeded;
+	if(!succeeded || rename(tempPath.c_str(), path.c_str()) != 0)
+	{
+		Log::printf(Log::debug, "Couldn't write object cache entry %s\n", path.c_str());
+		remove(tempPath.c_str());
+	}
+#endif
+}
+
 struct CommandLineOptions
 {
 	const char* filename = nullptr;
@@ -130,6 +273,7 @@ struct CommandLineOptions
 	bool enableEmscripten = true;
 	bool enableThreadTest = false;
 	bool precompiled = false;
+	const char* objectCacheDir = nullptr;
 };
 
 static int run(const CommandLineOptions& options)
@@ -142,7 +286,34 @@ static int run(const CommandLineOptions& options)
 
 	// Compile the module.
 	Runtime::Module* module = nullptr;
-	if(!options.precompiled) { module = Runtime::compileModule(irModule); }
+	if(!options.precompiled && options.objectCacheDir)
+	{
+		// Reuse the object code compiled by a previous run for the same input file.
+		std::string runtimeIdentity;
+		U64 moduleHash = 0;
+		if(!getRuntimeIdentity(runtimeIdentity)
+		   || !hashFile(options.filename, runtimeIdentity, moduleHash))
+		{ module = Runtime::compileModule(irModule); }
+		else
+		{
+			const std::string cachePath = getObjectCachePath(options.objectCacheDir, moduleHash);
+			std::vector<U8> objectCode;
+			if(loadCachedObjectCode(cachePath, moduleHash, objectCode))
+			{
+				Log::printf(Log::debug, "Loaded object code from %s\n", cachePath.c_str());
+				module = Runtime::loadPrecompiledModule(irModule, objectCode);
+			}
+			else
+			{
+				module = Runtime::compileModule(irModule);
+				saveCachedObjectCode(cachePath, moduleHash, Runtime::getObjectCode(module));
+			}
+		}
+	}
+	else if(!options.precompiled)
+	{
+		module = Runtime::compileModule(irModule);
+	}
 	else
 	{
 		const UserSection* precompiledObjectSection = nullptr;
@@ -334,6 +505,7 @@ static void showHelp()
 				"  --disable-emscripten  Disable Emscripten intrinsics\n"
 				"  --enable-thread-test  Enable ThreadTest intrinsics\n"
 				"  --precompiled         Use precompiled object code in programfile\n"
+				"  --object-cache dir    Cache compiled object code in dir between runs\n"
 				"  --                    Stop parsing arguments\n");
 }
 
@@ -372,6 +544,15 @@ int main(int argc, char** argv)
 		{
 			options.precompiled = true;
 		}
+		else if(!strcmp(*options.args, "--object-cache"))
+		{
+			if(!*++options.args)
+			{
+				showHelp();
+				return EXIT_FAILURE;
+			}
+			options.objectCacheDir = *options.args;
+		}
 		else if(!strcmp(*options.args, "--"))
 		{
 			++options.args;
@@ -42,6 +42,7 @@
 #include "convert.hpp"
 #include "safe_op.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <string>
@@ -71,6 +72,34 @@ namespace Exiv2 {
       enforce(!iIo.error(), err);
     }
 
+    // Number of leading payload bytes needed to read the canvas size and
+    // feature flags of VP8X, VP8, VP8L and ANMF chunks. The rest of these
+    // chunks, mostly image data, is skipped or streamed instead of buffered.
+    static const long WEBP_CHUNK_PREFIX_SIZE = 12;
+
+    // Reads up to WEBP_CHUNK_PREFIX_SIZE bytes of a chunk payload into
+    // |prefix| (zero filled) and positions |iIo| after the whole payload.
+    static void readChunkPrefix(BasicIo& iIo, DataBuf& prefix, long size)
+    {
+        const long prefixSize = std::min(size, WEBP_CHUNK_PREFIX_SIZE);
+        std::memset(prefix.pData_, 0, prefix.size_);
+        iIo.read(prefix.pData_, prefixSize);
+        if (size > prefixSize) iIo.seek(size - prefixSize, BasicIo::cur);
+    }
+
+    // Copies |size| bytes from |iIo| to |oIo| through a fixed size buffer so
+    // that large image chunks are not held in memory in one piece.
+    static void copyChunkData(BasicIo& iIo, BasicIo& oIo, long size)
+    {
+        DataBuf buf(std::min(size, 64L * 1024));
+        while (size > 0) {
+            const long count = std::min(size, buf.size_);
+            if (iIo.read(buf.pData_, count) != count) throw Error(kerInputDataReadFailed);
+            if (oIo.write(buf.pData_, count) != count) throw Error(kerImageWriteFailed);
+            size -= count;
+        }
+    }
+
     WebPImage::WebPImage(BasicIo::AutoPtr io)
     : Image(ImageType::webp, mdNone, io)
     {
@@ -191,10 +220,10 @@ namespace Exiv2 {
             io_->read(chunkId.pData_, WEBP_TAG_SIZE);
             io_->read(size_buff, WEBP_TAG_SIZE);
             long size = Exiv2::getULong(size_buff, littleEndian);
-            DataBuf payload(size);
-            io_->read(payload.pData_, payload.size_);
+            DataBuf prefix(WEBP_CHUNK_PREFIX_SIZE);
+            readChunkPrefix(*io_, prefix, size);
             byte c;
-            if ( payload.size_ % 2 ) io_->read(&c,1);
+            if ( size % 2 ) io_->read(&c,1);
 
             /* Chunk with information about features
              used in the file. */
@@ -206,12 +235,12 @@ namespace Exiv2 {
                 byte size_buf[WEBP_TAG_SIZE];
 
                 // Fetch width - stored in 24bits
-                memcpy(&size_buf, &payload.pData_[4], 3);
+                memcpy(&size_buf, &prefix.pData_[4], 3);
                 size_buf[3] = 0;
                 width = Exiv2::getULong(size_buf, littleEndian) + 1;
 
                 // Fetch height - stored in 24bits
-                memcpy(&size_buf, &payload.pData_[7], 3);
+                memcpy(&size_buf, &prefix.pData_[7], 3);
                 size_buf[3] = 0;
                 height = Exiv2::getULong(size_buf, littleEndian) + 1;
             }
@@ -237,17 +266,17 @@ namespace Exiv2 {
                    for height and width reference for VP8 chunks */
 
                 // Fetch width - stored in 16bits
-                memcpy(&size_buf, &payload.pData_[6], 2);
+                memcpy(&size_buf, &prefix.pData_[6], 2);
                 width = Exiv2::getUShort(size_buf, littleEndian) & 0x3fff;
 
                 // Fetch height - stored in 16bits
-                memcpy(&size_buf, &payload.pData_[8], 2);
+                memcpy(&size_buf, &prefix.pData_[8], 2);
                 height = Exiv2::getUShort(size_buf, littleEndian) & 0x3fff;
             }
 
             /* Chunk with with lossless image data. */
             if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_VP8L) && !has_alpha) {
-                if ((payload.pData_[4] & WEBP_VP8X_ALPHA_BIT) == WEBP_VP8X_ALPHA_BIT) {
+                if ((prefix.pData_[4] & WEBP_VP8X_ALPHA_BIT) == WEBP_VP8X_ALPHA_BIT) {
                     has_alpha = true;
                 }
             }
@@ -262,12 +291,12 @@ namespace Exiv2 {
                    each. Refer to this https://goo.gl/bpgMJf */
 
                 // Fetch width - 14 bits wide
-                memcpy(&size_buf_w, &payload.pData_[1], 2);
+                memcpy(&size_buf_w, &prefix.pData_[1], 2);
                 size_buf_w[1] &= 0x3F;
                 width = Exiv2::getUShort(size_buf_w, littleEndian) + 1;
 
                 // Fetch height - 14 bits wide
-                memcpy(&size_buf_h, &payload.pData_[2], 3);
+                memcpy(&size_buf_h, &prefix.pData_[2], 3);
                 size_buf_h[0] =
                   ((size_buf_h[0] >> 6) & 0x3) |
                     ((size_buf_h[1] & 0x3F) << 0x2);
@@ -279,7 +308,7 @@ namespace Exiv2 {
 
             /* Chunk with animation frame. */
             if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_ANMF) && !has_alpha) {
-                if ((payload.pData_[5] & 0x2) == 0x2) {
+                if ((prefix.pData_[5] & 0x2) == 0x2) {
                     has_alpha = true;
                 }
             }
@@ -288,12 +317,12 @@ namespace Exiv2 {
                 byte size_buf[WEBP_TAG_SIZE];
 
                 // Fetch width - stored in 24bits
-                memcpy(&size_buf, &payload.pData_[6], 3);
+                memcpy(&size_buf, &prefix.pData_[6], 3);
                 size_buf[3] = 0;
                 width = Exiv2::getULong(size_buf, littleEndian) + 1;
 
                 // Fetch height - stored in 24bits
-                memcpy(&size_buf, &payload.pData_[9], 3);
+                memcpy(&size_buf, &prefix.pData_[9], 3);
                 size_buf[3] = 0;
                 height = Exiv2::getULong(size_buf, littleEndian) + 1;
             }
@@ -317,11 +346,11 @@ namespace Exiv2 {
 
             long size = Exiv2::getULong(size_buff, littleEndian);
 
-            DataBuf payload(size);
-            io_->read(payload.pData_, size);
-            if ( io_->tell() % 2 ) io_->seek(+1,BasicIo::cur); // skip pad
-
             if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_VP8X)) {
+                DataBuf payload(size);
+                io_->read(payload.pData_, size);
+                if ( io_->tell() % 2 ) io_->seek(+1,BasicIo::cur); // skip pad
+
                 if (has_icc){
                     payload.pData_[0] |= WEBP_VP8X_ICC_BIT;
                 } else {
@@ -361,17 +390,23 @@ namespace Exiv2 {
                 }
             } else if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_ICCP)) {
                 // Skip it altogether handle it prior to here :)
+                io_->seek(size, BasicIo::cur);
+                if ( io_->tell() % 2 ) io_->seek(+1,BasicIo::cur); // skip pad
             } else if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_EXIF)) {
                 // Skip and add new data afterwards
+                io_->seek(size, BasicIo::cur);
+                if ( io_->tell() % 2 ) io_->seek(+1,BasicIo::cur); // skip pad
             } else if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_XMP)) {
                 // Skip and add new data afterwards
+                io_->seek(size, BasicIo::cur);
+                if ( io_->tell() % 2 ) io_->seek(+1,BasicIo::cur); // skip pad
             } else {
                 if (outIo.write(chunkId.pData_, WEBP_TAG_SIZE) != WEBP_TAG_SIZE)
                     throw Error(kerImageWriteFailed);
                 if (outIo.write(size_buff, WEBP_TAG_SIZE) != WEBP_TAG_SIZE)
                     throw Error(kerImageWriteFailed);
-                if (outIo.write(payload.pData_, payload.size_) != payload.size_)
-                    throw Error(kerImageWriteFailed);
+                copyChunkData(*io_, outIo, size);
+                if ( io_->tell() % 2 ) io_->seek(+1,BasicIo::cur); // skip pad
             }
 
             // Encoder required to pad odd sized data with a null byte
@@ -538,7 +573,10 @@ namespace Exiv2 {
             enforce(io_->tell() <= filesize, Exiv2::kerCorruptedMetadata);
             enforce(size <= (filesize - io_->tell()), Exiv2::kerCorruptedMetadata);
 
-            DataBuf payload(size);
+            // Canvas chunks only need their first bytes, and the image data
+            // that follows can be very large, so only read whole payloads for
+            // the metadata chunks.
+            DataBuf prefix(WEBP_CHUNK_PREFIX_SIZE);
 
             if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_VP8X) && !has_canvas_data) {
                 enforce(size >= 10, Exiv2::kerCorruptedMetadata);
@@ -546,32 +584,32 @@ namespace Exiv2 {
                 has_canvas_data = true;
                 byte size_buf[WEBP_TAG_SIZE];
 
-                readOrThrow(*io_, payload.pData_, payload.size_, Exiv2::kerCorruptedMetadata);
+                readChunkPrefix(*io_, prefix, size);
 
                 // Fetch width
-                memcpy(&size_buf, &payload.pData_[4], 3);
+                memcpy(&size_buf, &prefix.pData_[4], 3);
                 size_buf[3] = 0;
                 pixelWidth_ = Exiv2::getULong(size_buf, littleEndian) + 1;
 
                 // Fetch height
-                memcpy(&size_buf, &payload.pData_[7], 3);
+                memcpy(&size_buf, &prefix.pData_[7], 3);
                 size_buf[3] = 0;
                 pixelHeight_ = Exiv2::getULong(size_buf, littleEndian) + 1;
             } else if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_VP8) && !has_canvas_data) {
                 enforce(size >= 10, Exiv2::kerCorruptedMetadata);
 
                 has_canvas_data = true;
-                readOrThrow(*io_, payload.pData_, payload.size_, Exiv2::kerCorruptedMetadata);
+                readChunkPrefix(*io_, prefix, size);
                 byte size_buf[WEBP_TAG_SIZE];
 
                 // Fetch width""
-                memcpy(&size_buf, &payload.pData_[6], 2);
+                memcpy(&size_buf, &prefix.pData_[6], 2);
                 size_buf[2] = 0;
                 size_buf[3] = 0;
                 pixelWidth_ = Exiv2::getULong(size_buf, littleEndian) & 0x3fff;
 
                 // Fetch height
-                memcpy(&size_buf, &payload.pData_[8], 2);
+                memcpy(&size_buf, &prefix.pData_[8], 2);
                 size_buf[2] = 0;
                 size_buf[3] = 0;
                 pixelHeight_ = Exiv2::getULong(size_buf, littleEndian) & 0x3fff;
@@ -582,15 +620,15 @@ namespace Exiv2 {
                 byte size_buf_w[2];
                 byte size_buf_h[3];
 
-                readOrThrow(*io_, payload.pData_, payload.size_, Exiv2::kerCorruptedMetadata);
+                readChunkPrefix(*io_, prefix, size);
 
                 // Fetch width
-                memcpy(&size_buf_w, &payload.pData_[1], 2);
+                memcpy(&size_buf_w, &prefix.pData_[1], 2);
                 size_buf_w[1] &= 0x3F;
                 pixelWidth_ = Exiv2::getUShort(size_buf_w, littleEndian) + 1;
 
                 // Fetch height
-                memcpy(&size_buf_h, &payload.pData_[2], 3);
+                memcpy(&size_buf_h, &prefix.pData_[2], 3);
                 size_buf_h[0] = ((size_buf_h[0] >> 6) & 0x3) | ((size_buf_h[1]  & 0x3F) << 0x2);
                 size_buf_h[1] = ((size_buf_h[1] >> 6) & 0x3) | ((size_buf_h[2] & 0xF) << 0x2);
                 pixelHeight_ = Exiv2::getUShort(size_buf_h, littleEndian) + 1;
@@ -600,21 +638,23 @@ namespace Exiv2 {
                 has_canvas_data = true;
                 byte size_buf[WEBP_TAG_SIZE];
 
-                readOrThrow(*io_, payload.pData_, payload.size_, Exiv2::kerCorruptedMetadata);
+                readChunkPrefix(*io_, prefix, size);
 
                 // Fetch width
-                memcpy(&size_buf, &payload.pData_[6], 3);
+                memcpy(&size_buf, &prefix.pData_[6], 3);
                 size_buf[3] = 0;
                 pixelWidth_ = Exiv2::getULong(size_buf, littleEndian) + 1;
 
                 // Fetch height
-                memcpy(&size_buf, &payload.pData_[9], 3);
+                memcpy(&size_buf, &prefix.pData_[9], 3);
                 size_buf[3] = 0;
                 pixelHeight_ = Exiv2::getULong(size_buf, littleEndian) + 1;
             } else if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_ICCP)) {
+                DataBuf payload(size);
                 readOrThrow(*io_, payload.pData_, payload.size_, Exiv2::kerCorruptedMetadata);
                 this->setIccProfile(payload);
             } else if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_EXIF)) {
+                DataBuf payload(size);
                 readOrThrow(*io_, payload.pData_, payload.size_, Exiv2::kerCorruptedMetadata);
 
                 byte  size_buff[2];
@@ -696,6 +736,7 @@ namespace Exiv2 {
 
                 if (rawExifData) free(rawExifData);
             } else if (equalsWebPTag(chunkId, WEBP_CHUNK_HEADER_XMP)) {
+                DataBuf payload(size);
                 readOrThrow(*io_, payload.pData_, payload.size_, Exiv2::kerCorruptedMetadata);
                 xmpPacket_.assign(reinterpret_cast<char*>(payload.pData_), payload.size_);
                 if (xmpPacket_.size() > 0 && XmpParser::decode(xmpData_, xmpPacket_)) {
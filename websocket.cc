@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string.h>
+
 #include <algorithm>
 #include <limits>
 
@@ -251,9 +253,10 @@ void WebSocket::ProcessFrameData() {
       }
     } else {
       const char* msg_start = p;
-      while (p < end && *p != '\xff')
-        ++p;
-      if (p < end && *p == '\xff') {
+      const char* msg_end =
+          static_cast<const char*>(memchr(p, '\xff', end - p));
+      p = msg_end ? msg_end : end;
+      if (msg_end) {
         if (frame_byte == 0x00 && delegate_)
           delegate_->OnMessage(this, std::string(msg_start, p - msg_start));
         ++p;
@@ -267,9 +270,14 @@ void WebSocket::ProcessFrameData() {
 void WebSocket::AddToReadBuffer(const char* data, int len) {
   DCHECK(current_read_buf_);
   // Check if |current_read_buf_| has enough space to store |len| of |data|.
+  // Grow geometrically so that a large message arriving in many small reads
+  // doesn't reallocate and copy the whole buffer on every read.
   if (len >= current_read_buf_->RemainingCapacity()) {
-    current_read_buf_->SetCapacity(
-        current_read_buf_->offset() + len);
+    int needed = current_read_buf_->offset() + len;
+    int doubled = current_read_buf_->capacity() <=
+                  std::numeric_limits<int>::max() / 2 ?
+                  current_read_buf_->capacity() * 2 : needed;
+    current_read_buf_->SetCapacity(std::max(needed, doubled));
   }
 
   DCHECK(current_read_buf_->RemainingCapacity() >= len);
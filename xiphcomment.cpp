@@ -30,6 +30,21 @@
 
 using namespace TagLib;
 
+namespace
+{
+  // Reads the little endian 32 bit integer at \a pos without copying it out
+  // into a temporary ByteVector first, as data.mid(pos, 4).toUInt(false)
+  // would.  Like that call, a truncated value uses only the bytes available.
+
+  uint readUInt32LE(const ByteVector &data, uint pos)
+  {
+    uint value = 0;
+    for(uint i = 0; i < 4 && pos + i < data.size(); i++)
+      value |= uint(uchar(data[pos + i])) << (i * 8);
+    return value;
+  }
+}
+
 class Ogg::XiphComment::XiphCommentPrivate
 {
 public:
@@ -287,7 +302,7 @@ void Ogg::XiphComment::parse(const ByteVector &data)
 
   int pos = 0;
 
-  int vendorLength = data.mid(0, 4).toUInt(false);
+  int vendorLength = readUInt32LE(data, 0);
   pos += 4;
 
   d->vendorID = String(data.mid(pos, vendorLength), String::UTF8);
@@ -295,7 +310,7 @@ void Ogg::XiphComment::parse(const ByteVector &data)
 
   // Next the number of fields in the comment vector.
 
-  uint commentFields = data.mid(pos, 4).toUInt(false);
+  uint commentFields = readUInt32LE(data, pos);
   pos += 4;
 
   if(commentFields > (data.size() - 8) / 4) {
@@ -307,15 +322,19 @@ void Ogg::XiphComment::parse(const ByteVector &data)
     // Each comment field is in the format "KEY=value" in a UTF8 string and has
     // 4 bytes before the text starts that gives the length.
 
-    uint commentLength = data.mid(pos, 4).toUInt(false);
+    uint commentLength = readUInt32LE(data, pos);
     pos += 4;
 
-    String comment = String(data.mid(pos, commentLength), String::UTF8);
-    pos += commentLength;
-    if(pos > data.size()) {
+    // Check the length before decoding, so that a bogus length doesn't cost
+    // a UTF-8 conversion of the rest of the buffer just to be thrown away.
+
+    if(uint(pos) > data.size() || commentLength > data.size() - pos) {
       break;
     }
 
+    String comment = String(data.mid(pos, commentLength), String::UTF8);
+    pos += commentLength;
+
     int commentSeparatorPosition = comment.find("=");
     if(commentSeparatorPosition == -1) {
       break;
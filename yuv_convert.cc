@@ -34,6 +34,10 @@
 #include <emmintrin.h>
 #endif
 
+#if defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace media {
 
 // 16.16 fixed point arithmetic
@@ -138,7 +142,30 @@ static void FilterRows(uint8* ybuf, const uint8* y0_ptr, const uint8* y1_ptr,
     *dest64++ = y0;
   } while (dest64 < end64);
 }
-#else  // no MMX or SSE2
+#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON__)
+// NEON version does 16 pixels at a time
+static void FilterRows(uint8* ybuf, const uint8* y0_ptr, const uint8* y1_ptr,
+                       int source_width, int source_y_fraction) {
+  // FilterRows is only called with a non-zero fraction, so both weights fit
+  // in 8 bits.
+  uint8x8_t y1_fraction = vdup_n_u8(source_y_fraction);
+  uint8x8_t y0_fraction = vdup_n_u8(256 - source_y_fraction);
+  uint8* end = ybuf + source_width;
+
+  do {
+    uint8x16_t y0 = vld1q_u8(y0_ptr);
+    uint8x16_t y1 = vld1q_u8(y1_ptr);
+    uint16x8_t lo = vmull_u8(vget_low_u8(y0), y0_fraction);
+    uint16x8_t hi = vmull_u8(vget_high_u8(y0), y0_fraction);
+    lo = vmlal_u8(lo, vget_low_u8(y1), y1_fraction);
+    hi = vmlal_u8(hi, vget_high_u8(y1), y1_fraction);
+    vst1q_u8(ybuf, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+    y0_ptr += 16;
+    y1_ptr += 16;
+    ybuf += 16;
+  } while (ybuf < end);
+}
+#else  // no MMX, SSE2 or NEON
 // C version does 8 at a time to mimic MMX code
 static void FilterRows(uint8* ybuf, const uint8* y0_ptr, const uint8* y1_ptr,
                        int source_width, int source_y_fraction) {
@@ -254,7 +281,7 @@ void ScaleYUVToRGB32(const uint8* y_buf,
   }
 
   // Need padding because FilterRows() will write 1 to 16 extra pixels
-  // after the end for SSE2 version.
+  // after the end for SSE2 and NEON versions.
   uint8 yuvbuf[16 + kFilterBufferSize * 3 + 16];
   uint8* ybuf =
       reinterpret_cast<uint8*>(reinterpret_cast<uintptr_t>(yuvbuf + 15) & ~15);
@@ -999,35 +999,44 @@ String string_strip_tags(const char *s, const int len,
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static inline bool addslashes_needs_escape(char c) {
+  return c == '\0' || c == '\'' || c == '\"' || c == '\\';
+}
+
 String string_addslashes(const char *str, int length) {
   assert(str);
   if (length == 0) {
     return String();
   }
 
-  String retString((length << 1) + 1, ReserveString);
-  char *new_str = retString.bufferSlice().ptr;
   const char *source = str;
   const char *end = source + length;
+
+  // most inputs have nothing to escape; return an exact-size copy then
+  while (source < end && !addslashes_needs_escape(*source)) {
+    source++;
+  }
+  if (source == end) {
+    return String(str, length, CopyString);
+  }
+
+  String retString((length << 1) + 1, ReserveString);
+  char *new_str = retString.bufferSlice().ptr;
   char *target = new_str;
 
-  while (source < end) {
-    switch (*source) {
-    case '\0':
-      *target++ = '\\';
-      *target++ = '0';
-      break;
-    case '\'':
-    case '\"':
-    case '\\':
-      *target++ = '\\';
-      /* break is missing *intentionally* */
-    default:
-      *target++ = *source;
-      break;
-    }
+  // copy the clean runs in bulk and escape the bytes between them
+  const char *run = str;
+  for (;;) {
+    memcpy(target, run, source - run);
+    target += source - run;
+    if (source == end) break;
 
-    source++;
+    *target++ = '\\';
+    *target++ = *source == '\0' ? '0' : *source;
+    run = ++source;
+    while (source < end && !addslashes_needs_escape(*source)) {
+      source++;
+    }
   }
 
   retString.setSize(target - new_str);
@@ -138,7 +138,10 @@ void HuffmanDecoder::Initialize(const unsigned int *codeBits, unsigned int nCode
 	std::sort(m_codeToValue.begin(), m_codeToValue.end());
 
 	// initialize the decoding cache
-	m_cacheBits = STDMIN(9U, m_maxCodeBits);
+	// 11 bits resolves nearly all literal/length and distance codes of typical
+	// dynamic blocks in a single lookup, while keeping the cache small enough
+	// to clear on every block; entries are still filled lazily
+	m_cacheBits = STDMIN(11U, m_maxCodeBits);
 	m_cacheMask = (1 << m_cacheBits) - 1;
 	m_normalizedCacheMask = NormalizeCode(m_cacheMask, m_cacheBits);
 	CRYPTOPP_ASSERT(m_normalizedCacheMask == BitReverse(m_cacheMask));
@@ -1848,9 +1848,12 @@ CZNC::TrafficStatsMap CZNC::GetTrafficStats(TrafficStatsPair& Users,
     uiZNC_in = BytesRead();
     uiZNC_out = BytesWritten();
 
+    // msUsers is sorted by user name like ret, so every insertion goes to
+    // the end and the hint makes it constant time
     for (const auto& it : msUsers) {
-        ret[it.first] =
-            TrafficStatsPair(it.second->BytesRead(), it.second->BytesWritten());
+        ret.emplace_hint(ret.end(), it.first,
+                         TrafficStatsPair(it.second->BytesRead(),
+                                          it.second->BytesWritten()));
         uiUsers_in += it.second->BytesRead();
         uiUsers_out += it.second->BytesWritten();
     }
@@ -1864,8 +1867,9 @@ CZNC::TrafficStatsMap CZNC::GetTrafficStats(TrafficStatsPair& Users,
         }
 
         if (pUser) {
-            ret[pUser->GetUserName()].first += pSock->GetBytesRead();
-            ret[pUser->GetUserName()].second += pSock->GetBytesWritten();
+            TrafficStatsPair& Stats = ret[pUser->GetUserName()];
+            Stats.first += pSock->GetBytesRead();
+            Stats.second += pSock->GetBytesWritten();
             uiUsers_in += pSock->GetBytesRead();
             uiUsers_out += pSock->GetBytesWritten();
         } else {
@@ -1888,8 +1892,9 @@ CZNC::TrafficStatsMap CZNC::GetNetworkTrafficStats(const CString& sUsername,
     CUser* pUser = FindUser(sUsername);
     if (pUser) {
         for (const CIRCNetwork* pNetwork : pUser->GetNetworks()) {
-            Networks[pNetwork->GetName()].first = pNetwork->BytesRead();
-            Networks[pNetwork->GetName()].second = pNetwork->BytesWritten();
+            TrafficStatsPair& Stats = Networks[pNetwork->GetName()];
+            Stats.first = pNetwork->BytesRead();
+            Stats.second = pNetwork->BytesWritten();
             Total.first += pNetwork->BytesRead();
             Total.second += pNetwork->BytesWritten();
         }
@@ -1903,8 +1908,9 @@ CZNC::TrafficStatsMap CZNC::GetNetworkTrafficStats(const CString& sUsername,
             }
 
             if (pNetwork && pNetwork->GetUser() == pUser) {
-                Networks[pNetwork->GetName()].first = pSock->GetBytesRead();
-                Networks[pNetwork->GetName()].second = pSock->GetBytesWritten();
+                TrafficStatsPair& Stats = Networks[pNetwork->GetName()];
+                Stats.first = pSock->GetBytesRead();
+                Stats.second = pSock->GetBytesWritten();
                 Total.first += pSock->GetBytesRead();
                 Total.second += pSock->GetBytesWritten();
             }